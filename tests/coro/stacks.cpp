@@ -0,0 +1,125 @@
+#include <weave/coro/stack_allocator.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using weave::coro::Stack;
+using weave::coro::StackAllocator;
+
+//////////////////////////////////////////////////////////////////////
+
+TEST_SUITE(StackAllocator) {
+  SIMPLE_TEST(SizeClasses) {
+    auto& allocator = StackAllocator::Instance();
+    allocator.Configure({});
+
+    Stack tiny = allocator.Allocate(1000);
+    ASSERT_EQ(tiny.Size(), 8 * 1024);
+
+    Stack small = allocator.Allocate(20 * 1024);
+    ASSERT_EQ(small.Size(), 64 * 1024);
+    ASSERT_TRUE(small.HasGuardPage());
+
+    Stack medium = allocator.Allocate(100 * 1024);
+    ASSERT_EQ(medium.Size(), 256 * 1024);
+
+    // does not fit any class
+    Stack large = allocator.Allocate(3 * 1024 * 1024);
+    ASSERT_GE(large.Size(), 3 * 1024 * 1024);
+
+    // stack is writable end to end
+    auto view = small.MutView();
+    view.Data()[0] = 1;
+    view.Data()[view.Size() - 1] = 1;
+
+    allocator.Release(std::move(tiny));
+    allocator.Release(std::move(small));
+    allocator.Release(std::move(medium));
+    allocator.Release(std::move(large));
+
+    ASSERT_EQ(allocator.RetainedBytes(), (8 + 64 + 256) * 1024);
+  }
+
+  SIMPLE_TEST(Reuse) {
+    auto& allocator = StackAllocator::Instance();
+    allocator.Configure({});
+
+    Stack first = allocator.Allocate(1000);
+    char* memory = first.MutView().Data();
+    allocator.Release(std::move(first));
+
+    Stack second = allocator.Allocate(2000);
+    ASSERT_EQ(second.MutView().Data(), memory);
+    ASSERT_EQ(allocator.RetainedBytes(), 0);
+
+    allocator.Release(std::move(second));
+  }
+
+  SIMPLE_TEST(RetentionCap) {
+    auto& allocator = StackAllocator::Instance();
+
+    StackAllocator::Options options;
+    options.size_classes = {64 * 1024};
+    options.guard_pages = false;
+    options.max_retained_bytes = 2 * 64 * 1024;
+    allocator.Configure(options);
+
+    std::vector<Stack> stacks;
+    for (size_t i = 0; i < 5; ++i) {
+      stacks.push_back(allocator.Allocate(64 * 1024));
+      ASSERT_FALSE(stacks.back().HasGuardPage());
+    }
+
+    for (auto& stack : stacks) {
+      allocator.Release(std::move(stack));
+    }
+
+    ASSERT_EQ(allocator.RetainedBytes(), 2 * 64 * 1024);
+
+    allocator.Configure({});
+    ASSERT_EQ(allocator.RetainedBytes(), 0);
+  }
+
+  SIMPLE_TEST(Threads) {
+    auto& allocator = StackAllocator::Instance();
+    allocator.Configure({});
+
+    static const size_t kThreads = 4;
+    static const size_t kIterations = 1000;
+
+    std::vector<twist::ed::stdlike::thread> threads;
+
+    for (size_t t = 0; t < kThreads; ++t) {
+      threads.emplace_back([&allocator] {
+        for (size_t i = 0; i < kIterations; ++i) {
+          std::vector<Stack> stacks;
+
+          for (size_t j = 0; j < 20; ++j) {
+            stacks.push_back(allocator.Allocate(64 * 1024));
+            stacks.back().MutView().Data()[0] = 1;
+          }
+
+          for (auto& stack : stacks) {
+            allocator.Release(std::move(stack));
+          }
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    ASSERT_LE(allocator.RetainedBytes(),
+              StackAllocator::Options{}.max_retained_bytes);
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
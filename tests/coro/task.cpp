@@ -0,0 +1,326 @@
+#include <weave/coro/go.hpp>
+#include <weave/coro/run.hpp>
+#include <weave/coro/task.hpp>
+
+#include <weave/executors/manual.hpp>
+#include <weave/executors/tp/fast/thread_pool.hpp>
+
+#include <weave/futures/make/contract.hpp>
+#include <weave/futures/make/never.hpp>
+#include <weave/futures/make/submit.hpp>
+#include <weave/futures/make/value.hpp>
+
+#include <weave/futures/combine/seq/start.hpp>
+
+#include <weave/futures/run/detach.hpp>
+#include <weave/futures/run/thread_await.hpp>
+
+#include <weave/satellite/satellite.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <array>
+#include <atomic>
+#include <csignal>
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using Pool = executors::tp::fast::ThreadPool;
+
+//////////////////////////////////////////////////////////////////////
+
+coro::Task<int> Answer() {
+  co_return 42;
+}
+
+coro::Task<int> Fib(int n) {
+  if (n < 2) {
+    co_return n;
+  }
+
+  int left = co_await Fib(n - 1);
+  int right = co_await Fib(n - 2);
+
+  co_return left + right;
+}
+
+coro::Task<> Throw() {
+  throw std::runtime_error("Test");
+  co_return;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TEST_SUITE(CoroTask) {
+  SIMPLE_TEST(Lazy) {
+    executors::ManualExecutor manual;
+
+    bool started = false;
+
+    auto main = [&]() -> coro::Task<> {
+      started = true;
+      co_return;
+    };
+
+    auto task = main();
+
+    ASSERT_FALSE(started);
+
+    auto f = coro::Run(manual, std::move(task));
+
+    ASSERT_FALSE(started);
+    ASSERT_TRUE(manual.IsEmpty());
+
+    std::move(f) | futures::Detach();
+
+    ASSERT_EQ(manual.Drain(), 1);
+    ASSERT_TRUE(started);
+  }
+
+  SIMPLE_TEST(JustWorks) {
+    Pool pool{4};
+    pool.Start();
+
+    auto result = coro::Run(pool, Answer()) | futures::ThreadAwait();
+
+    ASSERT_EQ(*result, 42);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(AwaitTask) {
+    executors::ManualExecutor manual;
+
+    auto f = coro::Run(manual, Fib(15)) | futures::Start();
+
+    // awaited tasks are resumed inline
+    ASSERT_EQ(manual.Drain(), 1);
+
+    auto result = std::move(f) | futures::ThreadAwait();
+    ASSERT_EQ(*result, 610);
+  }
+
+  SIMPLE_TEST(AwaitFuture) {
+    Pool pool{4};
+    pool.Start();
+
+    auto main = [&]() -> coro::Task<int> {
+      Result<int> first = co_await futures::Value(1);
+      Result<int> second = co_await futures::Submit(pool, [] {
+        return 2;
+      });
+
+      co_return *first + *second;
+    };
+
+    auto result = coro::Run(pool, main()) | futures::ThreadAwait();
+
+    ASSERT_EQ(*result, 3);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(AwaitContract) {
+    executors::ManualExecutor manual;
+
+    auto [f, p] = futures::Contract<std::string>();
+
+    std::string out;
+
+    auto main = [&](auto future) -> coro::Task<> {
+      out = *(co_await std::move(future));
+    };
+
+    coro::Go(manual, main(std::move(f)));
+
+    ASSERT_EQ(manual.Drain(), 1);
+    ASSERT_TRUE(out.empty());
+
+    std::move(p).SetValue("Hi");
+
+    // resumed via executor
+    ASSERT_TRUE(out.empty());
+    ASSERT_EQ(manual.Drain(), 1);
+    ASSERT_EQ(out, "Hi");
+  }
+
+  SIMPLE_TEST(LargeFrame) {
+    executors::ManualExecutor manual;
+
+    auto [f, p] = futures::Contract<int>();
+
+    int out = 0;
+
+    auto main = [&](auto future) -> coro::Task<> {
+      // does not fit any pooled block
+      std::array<char, 1024> buffer{};
+      buffer.fill(1);
+
+      int value = *(co_await std::move(future));
+
+      for (char c : buffer) {
+        out += c;
+      }
+      out += value;
+    };
+
+    coro::Go(manual, main(std::move(f)));
+    manual.Drain();
+
+    std::move(p).SetValue(1);
+    manual.Drain();
+
+    ASSERT_EQ(out, 1025);
+  }
+
+  SIMPLE_TEST(ResumesOnItsExecutor) {
+    Pool pool{2};
+    Pool other{2};
+    pool.Start();
+    other.Start();
+
+    auto main = [&]() -> coro::Task<bool> {
+      co_await futures::Submit(other, [] {});
+
+      co_return Pool::Current() == &pool && satellite::GetExecutor() == &pool;
+    };
+
+    auto result = coro::Run(pool, main()) | futures::ThreadAwait();
+
+    ASSERT_TRUE(*result);
+
+    pool.Stop();
+    other.Stop();
+  }
+
+  SIMPLE_TEST(Exceptions) {
+    executors::ManualExecutor manual;
+
+    bool caught = false;
+
+    auto main = [&]() -> coro::Task<> {
+      try {
+        co_await Throw();
+      } catch (std::runtime_error&) {
+        caught = true;
+      }
+    };
+
+    coro::Go(manual, main());
+    manual.Drain();
+
+    ASSERT_TRUE(caught);
+  }
+
+  SIMPLE_TEST(RunPanicsOnException) {
+    // the child process is expected to abort
+    pid_t child = fork();
+
+    if (child == 0) {
+      executors::ManualExecutor manual;
+
+      coro::Run(manual, Throw()) | futures::Detach();
+      manual.Drain();
+
+      std::_Exit(0);
+    }
+
+    int status = 0;
+    waitpid(child, &status, 0);
+
+    ASSERT_TRUE(WIFSIGNALED(status));
+    ASSERT_EQ(WTERMSIG(status), SIGABRT);
+  }
+
+  SIMPLE_TEST(Cancel) {
+    executors::ManualExecutor manual;
+
+    bool cancelled = false;
+
+    auto main = [&]() -> coro::Task<> {
+      try {
+        co_await futures::Never();
+      } catch (cancel::CancelledException) {
+        cancelled = true;
+        throw;
+      }
+    };
+
+    auto f = coro::Run(manual, main()) | futures::Start();
+
+    ASSERT_EQ(manual.Drain(), 1);
+    ASSERT_FALSE(cancelled);
+
+    std::move(f).RequestCancel();
+
+    ASSERT_EQ(manual.Drain(), 1);
+    ASSERT_TRUE(cancelled);
+  }
+
+  SIMPLE_TEST(CancelPropagates) {
+    executors::ManualExecutor manual;
+
+    size_t steps = 0;
+
+    auto child = [&]() -> coro::Task<> {
+      ++steps;
+      co_await futures::Never();
+      ++steps;
+    };
+
+    auto main = [&]() -> coro::Task<> {
+      co_await child();
+      ++steps;
+    };
+
+    auto f = coro::Run(manual, main()) | futures::Start();
+
+    manual.Drain();
+    std::move(f).RequestCancel();
+    manual.Drain();
+
+    ASSERT_EQ(steps, 1);
+  }
+
+  SIMPLE_TEST(ManyTasks) {
+    Pool pool{4};
+    pool.Start();
+
+    static const size_t kTasks = 100'000;
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    std::atomic<size_t> sum{0};
+
+    auto task = [&](size_t i) -> coro::Task<> {
+      Result<size_t> value = co_await futures::Value(i);
+      sum.fetch_add(*value);
+      wg.Done();
+    };
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      coro::Go(pool, task(i));
+    }
+
+    wg.Wait();
+
+    ASSERT_EQ(sum.load(), kTasks * (kTasks - 1) / 2);
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -0,0 +1,221 @@
+#include <weave/executors/manual.hpp>
+#include <weave/executors/strand.hpp>
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/tp/compute/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <deque>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave;  // NOLINT
+
+//////////////////////////////////////////////////////////////////////
+
+class CountingTask : public executors::Task {
+ public:
+  CountingTask(size_t index, std::vector<size_t>& order,
+               threads::blocking::WaitGroup& wg)
+      : index_(index),
+        order_(order),
+        wg_(wg) {
+  }
+
+  void Run() noexcept override {
+    order_.push_back(index_);
+    wg_.Done();
+  }
+
+ private:
+  size_t index_;
+  std::vector<size_t>& order_;
+  threads::blocking::WaitGroup& wg_;
+};
+
+class ConcurrentTask : public executors::Task {
+ public:
+  ConcurrentTask(twist::ed::stdlike::atomic<size_t>& counter,
+                 threads::blocking::WaitGroup& wg)
+      : counter_(counter),
+        wg_(wg) {
+  }
+
+  void Run() noexcept override {
+    counter_.fetch_add(1);
+    wg_.Done();
+  }
+
+ private:
+  twist::ed::stdlike::atomic<size_t>& counter_;
+  threads::blocking::WaitGroup& wg_;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+TEST_SUITE(SubmitBatch) {
+  SIMPLE_TEST(Manual) {
+    executors::ManualExecutor manual;
+
+    static const size_t kTasks = 17;
+
+    std::vector<size_t> order;
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    std::deque<CountingTask> tasks;
+    wheels::IntrusiveList<executors::Task> batch;
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      batch.PushBack(&tasks.emplace_back(i, order, wg));
+    }
+
+    manual.SubmitBatch(batch, executors::SchedulerHint::UpToYou);
+
+    ASSERT_TRUE(batch.IsEmpty());
+    ASSERT_EQ(manual.TaskCount(), kTasks);
+
+    ASSERT_EQ(manual.Drain(), kTasks);
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      ASSERT_EQ(order[i], i);
+    }
+  }
+
+  SIMPLE_TEST(StrandFifo) {
+    executors::tp::compute::ThreadPool pool{4};
+    pool.Start();
+
+    executors::Strand strand{pool};
+
+    static const size_t kBatches = 100;
+    static const size_t kBatchSize = 33;
+
+    std::vector<size_t> order;
+    threads::blocking::WaitGroup wg;
+    wg.Add(kBatches * kBatchSize);
+
+    std::deque<CountingTask> tasks;
+
+    for (size_t i = 0; i < kBatches; ++i) {
+      wheels::IntrusiveList<executors::Task> batch;
+
+      for (size_t j = 0; j < kBatchSize; ++j) {
+        batch.PushBack(&tasks.emplace_back(i * kBatchSize + j, order, wg));
+      }
+
+      strand.SubmitBatch(batch, executors::SchedulerHint::UpToYou);
+    }
+
+    wg.Wait();
+
+    for (size_t i = 0; i < kBatches * kBatchSize; ++i) {
+      ASSERT_EQ(order[i], i);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ComputePool) {
+    executors::tp::compute::ThreadPool pool{4};
+    pool.Start();
+
+    static const size_t kTasks = 1000;
+
+    twist::ed::stdlike::atomic<size_t> counter{0};
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    std::deque<ConcurrentTask> tasks;
+    wheels::IntrusiveList<executors::Task> batch;
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      batch.PushBack(&tasks.emplace_back(counter, wg));
+    }
+
+    pool.SubmitBatch(batch, executors::SchedulerHint::UpToYou);
+
+    pool.WaitIdle();
+
+    ASSERT_EQ(counter.load(), kTasks);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ThreadPoolExternal) {
+    executors::ThreadPool pool{4};
+    pool.Start();
+
+    // larger than the local queue
+    static const size_t kTasks = 1000;
+
+    twist::ed::stdlike::atomic<size_t> counter{0};
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    std::deque<ConcurrentTask> tasks;
+    wheels::IntrusiveList<executors::Task> batch;
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      batch.PushBack(&tasks.emplace_back(counter, wg));
+    }
+
+    pool.SubmitBatch(batch, executors::SchedulerHint::UpToYou);
+
+    wg.Wait();
+    pool.WaitIdle();
+
+    ASSERT_EQ(counter.load(), kTasks);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ThreadPoolInternal) {
+    executors::ThreadPool pool{4};
+    pool.Start();
+
+    static const size_t kTasks = 1000;
+
+    twist::ed::stdlike::atomic<size_t> counter{0};
+    threads::blocking::WaitGroup wg;
+    wg.Add(3 * kTasks);
+
+    std::deque<ConcurrentTask> tasks;
+    for (size_t i = 0; i < 3 * kTasks; ++i) {
+      tasks.emplace_back(counter, wg);
+    }
+
+    executors::Submit(pool, [&] {
+      size_t next = 0;
+
+      for (auto hint :
+           {executors::SchedulerHint::UpToYou, executors::SchedulerHint::Next,
+            executors::SchedulerHint::Last}) {
+        wheels::IntrusiveList<executors::Task> batch;
+
+        for (size_t i = 0; i < kTasks; ++i) {
+          batch.PushBack(&tasks[next++]);
+        }
+
+        pool.SubmitBatch(batch, hint);
+      }
+    });
+
+    wg.Wait();
+    pool.WaitIdle();
+
+    ASSERT_EQ(counter.load(), 3 * kTasks);
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -0,0 +1,307 @@
+#include <weave/executors/tp/compute/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/event_count.hpp>
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+using namespace std::chrono_literals;
+
+using executors::tp::compute::QueueMode;
+using executors::tp::compute::ThreadPool;
+
+// Every test runs against both queue modes
+void CheckJustWorks(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(1);
+
+  executors::Submit(pool, [&] {
+    ASSERT_EQ(ThreadPool::Current(), &pool);
+    wg.Done();
+  });
+
+  wg.Wait();
+
+  pool.Stop();
+}
+
+void CheckWaitIdle(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  twist::ed::stdlike::atomic<size_t> done{0};
+
+  for (size_t i = 0; i < 100'000; ++i) {
+    executors::Submit(pool, [&] {
+      done.fetch_add(1);
+    });
+  }
+
+  pool.WaitIdle();
+
+  ASSERT_EQ(done.load(), 100'000);
+
+  pool.Stop();
+}
+
+void CheckManyProducers(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  const size_t kProducers = 4;
+  const size_t kTasks = 50'000;
+
+  twist::ed::stdlike::atomic<size_t> done{0};
+
+  std::vector<twist::ed::stdlike::thread> producers;
+  for (size_t i = 0; i < kProducers; ++i) {
+    producers.emplace_back([&] {
+      for (size_t j = 0; j < kTasks; ++j) {
+        executors::Submit(pool, [&] {
+          done.fetch_add(1);
+        });
+      }
+    });
+  }
+
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  pool.WaitIdle();
+
+  ASSERT_EQ(done.load(), kProducers * kTasks);
+
+  pool.Stop();
+}
+
+void CheckWorkerSubmits(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  twist::ed::stdlike::atomic<size_t> done{0};
+
+  // every task spawns the next one from the worker
+  for (size_t i = 0; i < 4; ++i) {
+    executors::Submit(pool, [&] {
+      for (size_t j = 0; j < 10'000; ++j) {
+        executors::Submit(pool, [&] {
+          done.fetch_add(1);
+        });
+      }
+    });
+  }
+
+  pool.WaitIdle();
+
+  ASSERT_EQ(done.load(), 40'000);
+
+  pool.Stop();
+}
+
+void CheckBatch(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  struct Counting : executors::Task {
+    twist::ed::stdlike::atomic<size_t>* done;
+
+    void Run() noexcept override {
+      done->fetch_add(1);
+    }
+  };
+
+  twist::ed::stdlike::atomic<size_t> done{0};
+  std::vector<Counting> tasks(1000);
+
+  wheels::IntrusiveList<executors::Task> batch;
+  for (auto& task : tasks) {
+    task.done = &done;
+    batch.PushBack(&task);
+  }
+
+  pool.SubmitBatch(batch, executors::SchedulerHint::UpToYou);
+  ASSERT_TRUE(batch.IsEmpty());
+
+  pool.WaitIdle();
+
+  ASSERT_EQ(done.load(), 1000);
+
+  pool.Stop();
+}
+
+// Workers fall asleep between rounds, every round has to wake them up
+void CheckWakeUps(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  for (size_t round = 0; round < 20; ++round) {
+    std::this_thread::sleep_for(5ms);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(8);
+
+    for (size_t i = 0; i < 8; ++i) {
+      executors::Submit(pool, [&] {
+        std::this_thread::sleep_for(1ms);
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+  }
+
+  pool.Stop();
+}
+
+void CheckParallel(QueueMode mode) {
+  ThreadPool pool{4, mode};
+  pool.Start();
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(4);
+
+  const auto start = std::chrono::steady_clock::now();
+
+  for (size_t i = 0; i < 4; ++i) {
+    executors::Submit(pool, [&] {
+      std::this_thread::sleep_for(200ms);
+      wg.Done();
+    });
+  }
+
+  wg.Wait();
+
+  ASSERT_TRUE(std::chrono::steady_clock::now() - start < 700ms);
+
+  pool.Stop();
+}
+
+void CheckStopRunsQueued(QueueMode mode) {
+  twist::ed::stdlike::atomic<size_t> done{0};
+
+  {
+    ThreadPool pool{2, mode};
+    pool.Start();
+
+    for (size_t i = 0; i < 10'000; ++i) {
+      executors::Submit(pool, [&] {
+        done.fetch_add(1);
+      });
+    }
+
+    pool.Stop();
+  }
+
+  ASSERT_EQ(done.load(), 10'000);
+}
+
+TEST_SUITE(ComputePool) {
+  SIMPLE_TEST(JustWorks) {
+    CheckJustWorks(QueueMode::Shared);
+    CheckJustWorks(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(WaitIdle) {
+    CheckWaitIdle(QueueMode::Shared);
+    CheckWaitIdle(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(ManyProducers) {
+    CheckManyProducers(QueueMode::Shared);
+    CheckManyProducers(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(WorkerSubmits) {
+    CheckWorkerSubmits(QueueMode::Shared);
+    CheckWorkerSubmits(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(Batch) {
+    CheckBatch(QueueMode::Shared);
+    CheckBatch(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(WakeUps) {
+    CheckWakeUps(QueueMode::Shared);
+    CheckWakeUps(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(Parallel) {
+    CheckParallel(QueueMode::Shared);
+    CheckParallel(QueueMode::PerWorker);
+  }
+
+  SIMPLE_TEST(StopRunsQueued) {
+    CheckStopRunsQueued(QueueMode::Shared);
+    CheckStopRunsQueued(QueueMode::PerWorker);
+  }
+}
+
+TEST_SUITE(EventCount) {
+  SIMPLE_TEST(NotifyBeforeWait) {
+    threads::blocking::EventCount events;
+
+    auto key = events.PrepareWait();
+    events.NotifyOne();
+    // returns right away: epoch has moved
+    events.Wait(key);
+  }
+
+  SIMPLE_TEST(CancelWait) {
+    threads::blocking::EventCount events;
+
+    auto key = events.PrepareWait();
+    events.CancelWait();
+
+    // nobody waits, epoch stays
+    events.NotifyAll();
+    ASSERT_EQ(events.PrepareWait(), key);
+    events.CancelWait();
+  }
+
+  SIMPLE_TEST(PingPong) {
+    threads::blocking::EventCount events;
+    twist::ed::stdlike::atomic<size_t> value{0};
+
+    const size_t kRounds = 10'000;
+
+    twist::ed::stdlike::thread consumer([&] {
+      for (size_t i = 1; i <= kRounds; ++i) {
+        while (true) {
+          auto key = events.PrepareWait();
+          if (value.load() >= i) {
+            events.CancelWait();
+            break;
+          }
+          events.Wait(key);
+        }
+      }
+    });
+
+    for (size_t i = 1; i <= kRounds; ++i) {
+      value.store(i);
+      events.NotifyOne();
+    }
+
+    consumer.join();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
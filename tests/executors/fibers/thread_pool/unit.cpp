@@ -1,3 +1,5 @@
+#include <weave/cancel/never.hpp>
+
 #include <weave/executors/fibers/thread_pool.hpp>
 #include <weave/executors/submit.hpp>
 
@@ -9,6 +11,8 @@
 #include <weave/fibers/sync/mutex.hpp>
 #include <weave/fibers/sync/wait_group.hpp>
 
+#include <weave/satellite/satellite.hpp>
+
 #include <weave/futures/make/submit.hpp>
 
 #include <weave/futures/combine/seq/and_then.hpp>
@@ -955,6 +959,174 @@ TEST_SUITE(Futures){
     wg.Wait();
     scheduler.Stop();
   }
+
+  SIMPLE_TEST(TimeSlice) {
+    executors::fibers::ThreadPool pool{1};
+    pool.SetTimeSlice({.budget = 1ms});
+    pool.Start();
+
+    std::atomic<bool> stop{false};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    // Never yields on its own
+    executors::Submit(pool, [&] {
+      while (!stop.load()) {
+        satellite::PollToken();
+      }
+      wg.Done();
+    });
+
+    executors::Submit(pool, [&] {
+      stop.store(true);
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(TimeSliceWatchdog) {
+    executors::fibers::ThreadPool pool{1};
+    pool.SetTimeSlice({.budget = 1ms, .watchdog = true});
+    pool.Start();
+
+    std::atomic<bool> stop{false};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    executors::Submit(pool, [&] {
+      while (!stop.load()) {
+        fibers::MaybeYield();
+      }
+      wg.Done();
+    });
+
+    wheels::StopWatch stop_watch;
+
+    executors::Submit(pool, [&] {
+      stop.store(true);
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_TRUE(stop_watch.Elapsed() < 500ms);
+
+    pool.Stop();
+  }
+
+  // Unlock switches to the waiter right away, the waiter must not
+  // pay for the slice its predecessor used up
+  SIMPLE_TEST(TimeSliceAfterSwitch) {
+    executors::fibers::ThreadPool pool{1};
+    pool.SetTimeSlice({.budget = 1ms});
+
+    fibers::Mutex mutex;
+    std::atomic<bool> other_ran{false};
+    bool preempted = false;
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    executors::Submit(pool, [&] {
+      mutex.Lock();
+
+      // let the waiter block on the mutex
+      fibers::Yield();
+
+      wheels::StopWatch stop_watch;
+      while (stop_watch.Elapsed() < 5ms) {
+        // burn the slice without checking it
+      }
+
+      executors::Submit(pool, [&] {
+        other_ran.store(true);
+      });
+
+      mutex.Unlock();
+      wg.Done();
+    });
+
+    executors::Submit(pool, [&] {
+      mutex.Lock();
+
+      fibers::MaybeYield();
+      preempted = other_ran.load();
+
+      mutex.Unlock();
+      wg.Done();
+    });
+
+    // both fibers are queued before the carrier starts
+    pool.Start();
+
+    wg.Wait();
+
+    ASSERT_FALSE(preempted);
+
+    pool.Stop();
+  }
+
+  struct AlwaysCancelled : cancel::SignalSender {
+    bool CancelRequested() override {
+      return true;
+    }
+
+    bool Cancellable() override {
+      return true;
+    }
+
+    void Attach(cancel::SignalReceiver*) override {
+    }
+
+    void Detach(cancel::SignalReceiver*) override {
+    }
+  };
+
+  SIMPLE_TEST(TimeSliceDoesNotPollToken) {
+    executors::fibers::ThreadPool pool{1};
+    pool.SetTimeSlice({.budget = 1ms});
+    pool.Start();
+
+    AlwaysCancelled cancelled;
+    fibers::Mutex mutex;
+    bool thrown = false;
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    executors::Submit(pool, [&] {
+      fibers::Fiber* self = fibers::Fiber::Self();
+      self->SetupFiber(self->GetScheduler(),
+                       cancel::Token::Fabricate(&cancelled));
+
+      wheels::StopWatch stop_watch;
+
+      // Slice expires many times, sync primitives must not throw
+      try {
+        while (stop_watch.Elapsed() < 20ms) {
+          mutex.Lock();
+          mutex.Unlock();
+          fibers::MaybeYield();
+        }
+      } catch (cancel::CancelledException&) {
+        thrown = true;
+      }
+
+      self->SetupFiber(self->GetScheduler(), cancel::Never());
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_FALSE(thrown);
+
+    pool.Stop();
+  }
 }
 
 } // namespace tests
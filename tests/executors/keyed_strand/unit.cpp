@@ -0,0 +1,217 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/keyed_strand.hpp>
+#include <weave/executors/manual.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/satellite/satellite.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+using namespace std::chrono_literals;
+
+using executors::KeyedStrand;
+using executors::ThreadPool;
+
+TEST_SUITE(KeyedStrand) {
+  SIMPLE_TEST(JustWorks) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    KeyedStrand<int> strand{pool};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    strand.Submit(7, [&] {
+      ASSERT_EQ(satellite::GetExecutor(), &pool);
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Manual) {
+    executors::ManualExecutor manual;
+
+    KeyedStrand<std::string> strand{manual, /*lanes=*/4};
+
+    ASSERT_EQ(strand.LaneCount(), 4);
+
+    std::vector<int> order;
+
+    strand.Submit("a", [&] {
+      order.push_back(1);
+    });
+    strand.Submit("b", [&] {
+      order.push_back(2);
+    });
+    strand.Submit("a", [&] {
+      order.push_back(3);
+    });
+
+    ASSERT_TRUE(manual.NonEmpty());
+
+    manual.Drain();
+
+    ASSERT_EQ(order.size(), 3);
+
+    // "a" keeps its order
+    auto first = std::find(order.begin(), order.end(), 1);
+    auto third = std::find(order.begin(), order.end(), 3);
+    ASSERT_TRUE(first < third);
+  }
+
+  SIMPLE_TEST(FifoPerKey) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    static const size_t kKeys = 1'000;
+    static const size_t kTasksPerKey = 100;
+
+    KeyedStrand<size_t> strand{pool, /*lanes=*/8};
+
+    // written by tasks of a single key only
+    std::vector<size_t> next(kKeys, 0);
+    twist::ed::stdlike::atomic<size_t> broken{0};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kKeys * kTasksPerKey);
+
+    for (size_t i = 0; i < kTasksPerKey; ++i) {
+      for (size_t key = 0; key < kKeys; ++key) {
+        strand.Submit(key, [&, key, i] {
+          if (next[key] != i) {
+            broken.fetch_add(1);
+          }
+          next[key] = i + 1;
+          wg.Done();
+        });
+      }
+    }
+
+    wg.Wait();
+
+    ASSERT_EQ(broken.load(), 0);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ConcurrentProducers) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    static const size_t kProducers = 4;
+    static const size_t kKeys = 64;
+    static const size_t kTasks = 10'000;
+
+    KeyedStrand<size_t> strand{pool};
+
+    // non-atomic on purpose: tasks of one key must not overlap
+    std::vector<size_t> counters(kKeys, 0);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kProducers * kTasks);
+
+    std::vector<twist::ed::stdlike::thread> producers;
+
+    for (size_t p = 0; p < kProducers; ++p) {
+      producers.emplace_back([&, p] {
+        for (size_t i = 0; i < kTasks; ++i) {
+          size_t key = (i * kProducers + p) % kKeys;
+          strand.Submit(key, [&, key] {
+            ++counters[key];
+            wg.Done();
+          });
+        }
+      });
+    }
+
+    for (auto& t : producers) {
+      t.join();
+    }
+
+    wg.Wait();
+
+    size_t total = 0;
+    for (size_t counter : counters) {
+      total += counter;
+    }
+    ASSERT_EQ(total, kProducers * kTasks);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(KeysRunInParallel) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    // all keys share a single lane
+    KeyedStrand<int> strand{pool, /*lanes=*/1};
+
+    twist::ed::stdlike::atomic<size_t> running{0};
+    twist::ed::stdlike::atomic<bool> overlapped{false};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    for (int key = 0; key < 2; ++key) {
+      strand.Submit(key, [&] {
+        running.fetch_add(1);
+        for (size_t i = 0; i < 200 && !overlapped.load(); ++i) {
+          if (running.load() == 2) {
+            overlapped.store(true);
+          }
+          std::this_thread::sleep_for(1ms);
+        }
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    ASSERT_TRUE(overlapped.load());
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ManyKeys) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    static const size_t kKeys = 100'000;
+
+    KeyedStrand<size_t> strand{pool};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kKeys);
+
+    for (size_t key = 0; key < kKeys; ++key) {
+      strand.Submit(key, [&] {
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -12,6 +12,7 @@
 #include <twist/ed/stdlike/thread.hpp>
 
 #include <deque>
+#include <vector>
 
 #if !defined(TWIST_FIBERS)
 
@@ -310,6 +311,98 @@ TEST_SUITE(Strand) {
 
     pool.Stop();
   }
+
+  SIMPLE_TEST(TaskBudget) {
+    executors::ManualExecutor manual;
+    executors::Strand strand{manual, {.max_tasks = 10}};
+
+    static const size_t kTasks = 95;
+
+    std::vector<size_t> order;
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      executors::Submit(strand, [&order, i] {
+        order.push_back(i);
+      });
+    }
+
+    ASSERT_TRUE(manual.RunNext());
+    ASSERT_EQ(order.size(), 10);
+
+    size_t runs = 1 + manual.Drain();
+    ASSERT_EQ(runs, 10);
+
+    ASSERT_EQ(order.size(), kTasks);
+    for (size_t i = 0; i < kTasks; ++i) {
+      ASSERT_EQ(order[i], i);
+    }
+  }
+
+  SIMPLE_TEST(TimeBudget) {
+    executors::ManualExecutor manual;
+    executors::Strand strand{manual, {.max_time = 10ms}};
+
+    size_t completed = 0;
+
+    for (size_t i = 0; i < 5; ++i) {
+      executors::Submit(strand, [&completed] {
+        twist::ed::stdlike::this_thread::sleep_for(6ms);
+        ++completed;
+      });
+    }
+
+    // at most two tasks fit into a single run
+    ASSERT_TRUE(manual.RunNext());
+    ASSERT_LE(completed, 2);
+
+    manual.Drain();
+    ASSERT_EQ(completed, 5);
+  }
+
+  SIMPLE_TEST(BudgetLetsOthersRun) {
+    executors::ManualExecutor manual;
+    executors::Strand strand{manual, {.max_tasks = 1}};
+
+    std::vector<int> order;
+
+    for (int i = 0; i < 3; ++i) {
+      executors::Submit(strand, [&order] {
+        order.push_back(0);
+      });
+    }
+
+    executors::Submit(manual, [&order] {
+      order.push_back(1);
+    });
+
+    manual.Drain();
+
+    // strand went to the back of the queue after the first task
+    ASSERT_EQ(order, (std::vector<int>{0, 1, 0, 0}));
+  }
+
+  SIMPLE_TEST(DestroyedByLastTask) {
+    executors::ManualExecutor manual;
+
+    auto* strand = new executors::Strand{manual};
+
+    size_t done = 0;
+
+    for (size_t i = 0; i < 3; ++i) {
+      executors::Submit(*strand, [&done] {
+        ++done;
+      });
+    }
+
+    executors::Submit(*strand, [strand, &done] {
+      ++done;
+      delete strand;
+    });
+
+    manual.Drain();
+
+    ASSERT_EQ(done, 4);
+  }
 }
 
 #endif
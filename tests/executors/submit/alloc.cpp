@@ -0,0 +1,143 @@
+#include <weave/executors/manual.hpp>
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include "../../futures/alloc/guard.hpp"
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <array>
+
+#if !defined(TWIST_FIBERS) && !(__has_feature(address_sanitizer) || __has_feature(thread_sanitizer) || defined(__SANITIZE_ADDRESS__))
+
+using namespace weave;  // NOLINT
+
+using executors::ThreadPool;
+
+//////////////////////////////////////////////////////////////////////
+
+static const size_t kRound = 10'000;
+
+// Task memory circulates between threads, so caches
+// settle after a few rounds rather than after the first one
+static const size_t kMaxWarmUpRounds = 64;
+
+template <typename F>
+size_t AllocationsPerRound(F round) {
+  size_t before = AllocationCount();
+  round();
+  return AllocationCount() - before;
+}
+
+template <typename F>
+void ExpectSteadyState(F round) {
+  for (size_t i = 0; i < kMaxWarmUpRounds; ++i) {
+    if (AllocationsPerRound(round) == 0) {
+      return;
+    }
+  }
+
+  WHEELS_PANIC("Submit keeps allocating");
+}
+
+//////////////////////////////////////////////////////////////////////
+
+TEST_SUITE(AllocFreeSubmit) {
+  SIMPLE_TEST(Manual) {
+    executors::ManualExecutor manual;
+
+    size_t done = 0;
+
+    auto round = [&] {
+      for (size_t i = 0; i < kRound; ++i) {
+        executors::Submit(manual, [&done] {
+          ++done;
+        });
+      }
+      manual.Drain();
+    };
+
+    // fills the local cache
+    round();
+
+    {
+      AllocationGuard do_not_alloc;
+      round();
+    }
+
+    ASSERT_EQ(done, 2 * kRound);
+  }
+
+  SIMPLE_TEST(BigCapture) {
+    executors::ManualExecutor manual;
+
+    std::array<char, 150> payload{};
+    payload[0] = 'a';
+
+    size_t done = 0;
+
+    auto round = [&] {
+      for (size_t i = 0; i < kRound; ++i) {
+        executors::Submit(manual, [payload, &done] {
+          done += payload[0] == 'a';
+        });
+      }
+      manual.Drain();
+    };
+
+    round();
+
+    {
+      AllocationGuard do_not_alloc;
+      round();
+    }
+
+    ASSERT_EQ(done, 2 * kRound);
+  }
+
+  SIMPLE_TEST(ExternalSubmits) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    twist::ed::stdlike::atomic<size_t> done{0};
+
+    ExpectSteadyState([&] {
+      for (size_t i = 0; i < kRound; ++i) {
+        executors::Submit(pool, [&done] {
+          done.fetch_add(1, std::memory_order::relaxed);
+        });
+      }
+      pool.WaitIdle();
+    });
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(WorkerSubmits) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    twist::ed::stdlike::atomic<size_t> done{0};
+
+    ExpectSteadyState([&] {
+      for (size_t i = 0; i < 4; ++i) {
+        executors::Submit(pool, [&] {
+          for (size_t j = 0; j < kRound / 4; ++j) {
+            executors::Submit(pool, [&done] {
+              done.fetch_add(1, std::memory_order::relaxed);
+            });
+          }
+        });
+      }
+      pool.WaitIdle();
+    });
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
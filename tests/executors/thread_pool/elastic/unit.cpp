@@ -0,0 +1,120 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using namespace std::chrono_literals;
+
+static void WaitFor(auto pred, std::chrono::milliseconds limit) {
+  auto start = std::chrono::steady_clock::now();
+
+  while (!pred() && std::chrono::steady_clock::now() - start < limit) {
+    std::this_thread::sleep_for(10ms);
+  }
+}
+
+TEST_SUITE(ElasticPool) {
+  SIMPLE_TEST(ShrinksWhenIdle) {
+    executors::ThreadPool pool{4};
+    pool.SetElasticity({.min_threads = 1, .idle_timeout = 50ms});
+    pool.Start();
+
+    ASSERT_EQ(pool.ActiveWorkers(), 4);
+
+    WaitFor([&] {
+      return pool.ActiveWorkers() == 1;
+    }, 5s);
+
+    ASSERT_EQ(pool.ActiveWorkers(), 1);
+
+    // still runs tasks
+    bool done = false;
+
+    executors::Submit(pool, [&] {
+      done = true;
+    });
+
+    pool.WaitIdle();
+
+    ASSERT_TRUE(done);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(GrowsUnderLoad) {
+    executors::ThreadPool pool{4};
+    pool.SetElasticity({.min_threads = 1, .idle_timeout = 50ms});
+    pool.Start();
+
+    WaitFor([&] {
+      return pool.ActiveWorkers() == 1;
+    }, 5s);
+
+    std::atomic<size_t> running{0};
+    std::atomic<size_t> max_running{0};
+
+    threads::blocking::WaitGroup wg;
+
+    for (size_t i = 0; i < 64; ++i) {
+      wg.Add(1);
+
+      executors::Submit(pool, [&] {
+        size_t now = running.fetch_add(1) + 1;
+
+        size_t prev = max_running.load();
+        while (prev < now && !max_running.compare_exchange_weak(prev, now)) {
+        }
+
+        std::this_thread::sleep_for(5ms);
+
+        running.fetch_sub(1);
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    ASSERT_GT(max_running.load(), 1);
+    ASSERT_LE(pool.ActiveWorkers(), 4);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(NeverBelowMin) {
+    executors::ThreadPool pool{4};
+    pool.SetElasticity({.min_threads = 2, .idle_timeout = 20ms});
+    pool.Start();
+
+    std::this_thread::sleep_for(500ms);
+
+    ASSERT_EQ(pool.ActiveWorkers(), 2);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(StopWhileRetiring) {
+    for (size_t i = 0; i < 10; ++i) {
+      executors::ThreadPool pool{4};
+      pool.SetElasticity({.min_threads = 1, .idle_timeout = 1ms});
+      pool.Start();
+
+      std::this_thread::sleep_for(std::chrono::milliseconds(i));
+
+      pool.Stop();
+    }
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -0,0 +1,163 @@
+#include <weave/executors/tp/fast/queues/global_queue.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using executors::Task;
+using executors::tp::fast::GlobalQueue;
+using executors::tp::fast::GlobalQueueShardedImpl;
+
+// Built with __WEAVE_SHARDED_GQ__, see tests/CMakeLists.txt
+static_assert(std::is_same_v<GlobalQueue, GlobalQueueShardedImpl>);
+
+struct TestTask : Task {
+  explicit TestTask(size_t i)
+      : index(i) {
+  }
+
+  void Run() noexcept override {
+  }
+
+  size_t index;
+};
+
+std::vector<TestTask> MakeTasks(size_t count) {
+  std::vector<TestTask> tasks;
+  tasks.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    tasks.emplace_back(i);
+  }
+  return tasks;
+}
+
+size_t IndexOf(Task* task) {
+  return static_cast<TestTask*>(task)->index;
+}
+
+TEST_SUITE(ShardedGlobalQueue) {
+  SIMPLE_TEST(Empty) {
+    GlobalQueue queue;
+
+    std::array<Task*, 4> buffer{};
+
+    ASSERT_EQ(queue.TryPop(), nullptr);
+    ASSERT_EQ(queue.Grab(buffer, 1), 0);
+  }
+
+  // Single producer lands in a single shard
+  SIMPLE_TEST(Fifo) {
+    GlobalQueue queue;
+    auto tasks = MakeTasks(10);
+
+    for (auto& task : tasks) {
+      queue.Push(&task);
+    }
+
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      Task* task = queue.TryPop();
+      ASSERT_NE(task, nullptr);
+      ASSERT_EQ(IndexOf(task), i);
+    }
+
+    ASSERT_EQ(queue.TryPop(), nullptr);
+  }
+
+  SIMPLE_TEST(AppendAndGrab) {
+    GlobalQueue queue;
+    auto tasks = MakeTasks(16);
+
+    std::array<Task*, 16> overflow{};
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      overflow[i] = &tasks[i];
+    }
+
+    queue.Append(overflow);
+
+    std::array<Task*, 16> buffer{};
+
+    // share of one of 4 workers
+    ASSERT_EQ(queue.Grab(buffer, 4), 4);
+
+    for (size_t i = 0; i < 4; ++i) {
+      ASSERT_EQ(IndexOf(buffer[i]), i);
+    }
+
+    ASSERT_EQ(queue.Grab(buffer, 1), 12);
+    ASSERT_EQ(queue.TryPop(), nullptr);
+  }
+
+  // Consumers race with producers pushing into other shards
+  SIMPLE_TEST(Concurrent) {
+    static const size_t kProducers = 4;
+    static const size_t kConsumers = 4;
+    static const size_t kPerProducer = 50'000;
+    static const size_t kTasks = kProducers * kPerProducer;
+
+    GlobalQueue queue;
+    auto tasks = MakeTasks(kTasks);
+
+    std::vector<std::atomic<int>> seen(kTasks);
+    std::atomic<size_t> taken{0};
+
+    std::vector<std::thread> threads;
+
+    for (size_t p = 0; p < kProducers; ++p) {
+      threads.emplace_back([&, p] {
+        for (size_t i = p * kPerProducer; i < (p + 1) * kPerProducer; ++i) {
+          queue.Push(&tasks[i]);
+        }
+      });
+    }
+
+    for (size_t c = 0; c < kConsumers; ++c) {
+      threads.emplace_back([&, c] {
+        std::array<Task*, 8> buffer{};
+
+        while (taken.load() < kTasks) {
+          size_t grabbed = 0;
+
+          if (c % 2 == 0) {
+            if (Task* task = queue.TryPop()) {
+              buffer[0] = task;
+              grabbed = 1;
+            }
+          } else {
+            grabbed = queue.Grab(buffer, kConsumers);
+          }
+
+          for (size_t i = 0; i < grabbed; ++i) {
+            seen[IndexOf(buffer[i])].fetch_add(1);
+          }
+
+          taken.fetch_add(grabbed);
+        }
+      });
+    }
+
+    for (auto& thread : threads) {
+      thread.join();
+    }
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      ASSERT_EQ(seen[i].load(), 1);
+    }
+
+    std::array<Task*, 8> buffer{};
+
+    ASSERT_EQ(queue.TryPop(), nullptr);
+    ASSERT_EQ(queue.Grab(buffer, 1), 0);
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
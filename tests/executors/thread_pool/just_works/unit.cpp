@@ -140,6 +140,30 @@ TEST_SUITE(ThreadPool) {
     pool.Stop();
   }
 
+  // Tasks spawned by a worker can only be stolen
+  TEST(LoadAwareStealing, wheels::test::TestOptions().TimeLimit(1s)) {
+    executors::ThreadPool pool{4};
+
+    pool.SetStealPolicy(executors::tp::fast::StealPolicy::LoadAware);
+    pool.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(4);
+
+    executors::Submit(pool, [&] {
+      for (size_t i = 0; i < 4; ++i) {
+        executors::Submit(pool, [&] {
+          std::this_thread::sleep_for(750ms);
+          wg.Done();
+        });
+      }
+    });
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
   SIMPLE_TEST(TwoPools) {
     executors::ThreadPool pool1{1};
     executors::ThreadPool pool2{1};
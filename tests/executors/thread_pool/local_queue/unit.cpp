@@ -0,0 +1,204 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/executors/tp/fast/local_queue.hpp>
+#include <weave/executors/tp/fast/queues/growable_work_stealing_queue.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using executors::Task;
+using executors::tp::fast::GrowableWorkStealingQueue;
+
+struct TestTask : Task {
+  explicit TestTask(size_t i)
+      : index(i) {
+  }
+
+  void Run() noexcept override {
+  }
+
+  size_t index;
+};
+
+std::vector<TestTask> MakeTasks(size_t count) {
+  std::vector<TestTask> tasks;
+  tasks.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    tasks.emplace_back(i);
+  }
+  return tasks;
+}
+
+size_t IndexOf(Task* task) {
+  return static_cast<TestTask*>(task)->index;
+}
+
+TEST_SUITE(GrowableWorkStealingQueue) {
+  SIMPLE_TEST(PushPop) {
+    GrowableWorkStealingQueue queue{4};
+    auto tasks = MakeTasks(3);
+
+    ASSERT_EQ(queue.TryPop(), nullptr);
+
+    for (auto& task : tasks) {
+      ASSERT_TRUE(queue.TryPush(&task));
+    }
+
+    ASSERT_EQ(queue.SizeEstimate(), 3);
+
+    for (size_t i = 0; i < 3; ++i) {
+      ASSERT_EQ(IndexOf(queue.TryPop()), i);
+    }
+
+    ASSERT_EQ(queue.TryPop(), nullptr);
+  }
+
+  SIMPLE_TEST(Grows) {
+    GrowableWorkStealingQueue queue{4};
+    auto tasks = MakeTasks(1000);
+
+    // wrap around before growing
+    queue.TryPush(&tasks[0]);
+    queue.TryPush(&tasks[1]);
+    queue.TryPop();
+    queue.TryPop();
+
+    for (auto& task : tasks) {
+      ASSERT_TRUE(queue.TryPush(&task));
+    }
+
+    ASSERT_EQ(queue.SizeEstimate(), 1000);
+    ASSERT_TRUE(queue.Capacity() >= 1000);
+
+    // FIFO survives resizes
+    for (size_t i = 0; i < 1000; ++i) {
+      ASSERT_EQ(IndexOf(queue.TryPop()), i);
+    }
+  }
+
+  SIMPLE_TEST(PushSome) {
+    GrowableWorkStealingQueue queue{2};
+    auto tasks = MakeTasks(100);
+
+    wheels::IntrusiveList<Task> list;
+    for (auto& task : tasks) {
+      list.PushBack(&task);
+    }
+
+    ASSERT_EQ(queue.PushSome(list), 100);
+    ASSERT_TRUE(list.IsEmpty());
+
+    for (size_t i = 0; i < 100; ++i) {
+      ASSERT_EQ(IndexOf(queue.TryPop()), i);
+    }
+  }
+
+  SIMPLE_TEST(GrabHalf) {
+    GrowableWorkStealingQueue queue{4};
+    auto tasks = MakeTasks(64);
+
+    std::vector<Task*> items;
+    for (auto& task : tasks) {
+      items.push_back(&task);
+    }
+    queue.PushMany(items);
+
+    std::array<Task*, 128> buffer{};
+    ASSERT_EQ(queue.Grab(buffer), 32);
+    ASSERT_EQ(IndexOf(buffer[0]), 0);
+    ASSERT_EQ(IndexOf(buffer[31]), 31);
+
+    // capped by the buffer
+    ASSERT_EQ(queue.Grab({buffer.begin(), 4}), 4);
+    ASSERT_EQ(queue.SizeEstimate(), 28);
+  }
+
+  // Owner pushes through many resizes while thieves steal
+  SIMPLE_TEST(StealWhileGrowing) {
+    static const size_t kTasks = 100'000;
+    static const size_t kThieves = 3;
+
+    GrowableWorkStealingQueue queue{2};
+    auto tasks = MakeTasks(kTasks);
+
+    std::vector<std::atomic<int>> seen(kTasks);
+    std::atomic<bool> done{false};
+
+    std::vector<std::thread> thieves;
+    for (size_t t = 0; t < kThieves; ++t) {
+      thieves.emplace_back([&] {
+        std::array<Task*, 16> buffer{};
+        while (!done.load() || queue.SizeEstimate() != 0) {
+          size_t grabbed = queue.Grab(buffer);
+          for (size_t i = 0; i < grabbed; ++i) {
+            seen[IndexOf(buffer[i])].fetch_add(1);
+          }
+        }
+      });
+    }
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      queue.TryPush(&tasks[i]);
+
+      if (i % 3 == 0) {
+        if (Task* task = queue.TryPop()) {
+          seen[IndexOf(task)].fetch_add(1);
+        }
+      }
+    }
+
+    done.store(true);
+
+    for (auto& thief : thieves) {
+      thief.join();
+    }
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      ASSERT_EQ(seen[i].load(), 1);
+    }
+  }
+}
+
+// Workers run whichever queue the build picked,
+// see WEAVE_GROWABLE_LOCAL_QUEUE
+TEST_SUITE(DefaultLocalQueue) {
+  // Children far outnumber the initial capacity of a local queue
+  SIMPLE_TEST(WorkerFanOut) {
+    static const size_t kSpawners = 8;
+    static const size_t kFanOut = 8 * executors::tp::fast::kLocalQueueCapacity;
+
+    executors::ThreadPool pool{4};
+    pool.Start();
+
+    std::atomic<size_t> done{0};
+
+    for (size_t i = 0; i < kSpawners; ++i) {
+      executors::Submit(pool, [&] {
+        for (size_t j = 0; j < kFanOut; ++j) {
+          executors::Submit(pool, [&] {
+            done.fetch_add(1);
+          });
+        }
+      });
+    }
+
+    pool.WaitIdle();
+
+    ASSERT_EQ(done.load(), kSpawners * kFanOut);
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -0,0 +1,246 @@
+#include <weave/cancel/never.hpp>
+
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+#include <weave/fibers/sched/sleep_for.hpp>
+
+#include <weave/futures/make/after.hpp>
+
+#include <weave/futures/combine/seq/and_then.hpp>
+#include <weave/futures/combine/seq/on_cancel.hpp>
+#include <weave/futures/combine/seq/on_success.hpp>
+#include <weave/futures/combine/seq/start.hpp>
+
+#include <weave/futures/run/detach.hpp>
+#include <weave/futures/run/discard.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using namespace std::chrono_literals;
+
+TEST_SUITE(PoolTimers) {
+  SIMPLE_TEST(SleepFor) {
+    executors::ThreadPool pool{4};
+    pool.Timers().MakeGlobal();
+
+    pool.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    auto start = std::chrono::steady_clock::now();
+
+    fibers::Go(pool, [&] {
+      fibers::SleepFor(100ms);
+
+      auto elapsed = std::chrono::steady_clock::now() - start;
+
+      ASSERT_GE(elapsed, 100ms);
+      ASSERT_LE(elapsed, 100ms + 50ms);
+
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    pool.Stop();
+    satellite::ResetGlobalProcessor();
+  }
+
+  SIMPLE_TEST(ManySleepers) {
+    executors::ThreadPool pool{4};
+    pool.Timers().MakeGlobal();
+
+    pool.Start();
+
+    static const size_t kFibers = 1000;
+
+    std::atomic<size_t> woken{0};
+
+    for (size_t i = 0; i < kFibers; ++i) {
+      fibers::Go(pool, [&, i] {
+        for (size_t j = 0; j < 3; ++j) {
+          fibers::SleepFor(timers::Millis(1 + (i + j) % 10));
+        }
+
+        woken.fetch_add(1);
+      });
+    }
+
+    pool.WaitIdle();
+
+    // sleeping fibers are not counted as work
+    while (woken.load() != kFibers) {
+      std::this_thread::sleep_for(10ms);
+    }
+
+    pool.Stop();
+    satellite::ResetGlobalProcessor();
+  }
+
+  SIMPLE_TEST(ExternalAfter) {
+    executors::ThreadPool pool{2};
+
+    pool.Start();
+
+    // let workers park
+    std::this_thread::sleep_for(50ms);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    auto start = std::chrono::steady_clock::now();
+
+    futures::After(pool.Timers().DelayFromThis(50ms)) | futures::AndThen([&](Unit) {
+      auto elapsed = std::chrono::steady_clock::now() - start;
+
+      ASSERT_GE(elapsed, 50ms);
+      ASSERT_LE(elapsed, 50ms + 50ms);
+
+      wg.Done();
+    }) | futures::Detach();
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(EarlierDeadline) {
+    executors::ThreadPool pool{1};
+
+    pool.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    auto start = std::chrono::steady_clock::now();
+
+    futures::After(pool.Timers().DelayFromThis(1s)) | futures::AndThen([&](Unit) {
+      wg.Done();
+    }) | futures::Detach();
+
+    std::this_thread::sleep_for(20ms);
+
+    // timekeeper must be woken up
+    futures::After(pool.Timers().DelayFromThis(10ms)) | futures::AndThen([&](Unit) {
+      ASSERT_LE(std::chrono::steady_clock::now() - start, 100ms);
+      wg.Done();
+    }) | futures::Detach();
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  struct TestTimer : timers::TimerBase {
+    explicit TestTimer(timers::Millis d)
+        : delay(d) {
+    }
+
+    timers::Millis GetDelay() override {
+      return delay;
+    }
+
+    cancel::Token CancelToken() override {
+      return cancel::Never();
+    }
+
+    void Run() noexcept override {
+      fired.store(true);
+    }
+
+    timers::Millis delay;
+    std::atomic<bool> fired{false};
+  };
+
+  SIMPLE_TEST(LaterDeadline) {
+    executors::ThreadPool pool{1};
+
+    pool.Start();
+
+    TestTimer first{1s};
+    pool.Timers().AddTimer(&first);
+
+    // let the worker become a timekeeper
+    std::this_thread::sleep_for(50ms);
+
+    const size_t wakeups = pool.Timers().TimekeeperWakeups();
+
+    // timekeeper wakes up earlier anyway
+    TestTimer later{2s};
+    pool.Timers().AddTimer(&later);
+
+    ASSERT_EQ(pool.Timers().TimekeeperWakeups(), wakeups);
+
+    TestTimer earlier{10ms};
+    pool.Timers().AddTimer(&earlier);
+
+    ASSERT_EQ(pool.Timers().TimekeeperWakeups(), wakeups + 1);
+
+    while (!earlier.fired.load()) {
+      std::this_thread::sleep_for(1ms);
+    }
+
+    pool.Stop();
+
+    ASSERT_TRUE(first.fired.load());
+    ASSERT_TRUE(later.fired.load());
+  }
+
+  SIMPLE_TEST(Cancel) {
+    executors::ThreadPool pool{2};
+
+    pool.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    auto start = std::chrono::steady_clock::now();
+
+    auto f = futures::After(pool.Timers().DelayFromThis(5s)) | futures::OnSuccess([]{
+      ASSERT_TRUE(false);
+    }) | futures::OnCancel([&]{
+      ASSERT_LE(std::chrono::steady_clock::now() - start, 100ms + 50ms);
+      wg.Done();
+    }) | futures::Start();
+
+    std::this_thread::sleep_for(100ms);
+
+    std::move(f).RequestCancel();
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(FiredOnStop) {
+    executors::ThreadPool pool{2};
+
+    pool.Start();
+
+    bool fired = false;
+
+    futures::After(pool.Timers().DelayFromThis(1h)) | futures::AndThen([&](Unit) {
+      fired = true;
+    }) | futures::Detach();
+
+    pool.Stop();
+
+    ASSERT_TRUE(fired);
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
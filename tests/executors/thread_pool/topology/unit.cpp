@@ -0,0 +1,132 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using namespace std::chrono_literals;
+
+using executors::tp::fast::Topology;
+
+// two nodes without pinning
+Topology TwoNodes() {
+  return Topology{{{}, {}}};
+}
+
+TEST_SUITE(Topology) {
+  SIMPLE_TEST(ParseCpuList) {
+    auto cpus = Topology::ParseCpuList("0-3,8,10-11\n");
+
+    std::vector<int> expected{0, 1, 2, 3, 8, 10, 11};
+    ASSERT_EQ(cpus, expected);
+  }
+
+  SIMPLE_TEST(ParseMalformed) {
+    ASSERT_TRUE(Topology::ParseCpuList("").empty());
+    ASSERT_TRUE(Topology::ParseCpuList("3-1").empty());
+    ASSERT_TRUE(Topology::ParseCpuList("a-b").empty());
+  }
+
+  SIMPLE_TEST(Detect) {
+    auto topology = Topology::Detect();
+
+    ASSERT_TRUE(topology.NumNodes() > 0);
+  }
+
+  SIMPLE_TEST(JustWorks) {
+    executors::ThreadPool pool{4, TwoNodes()};
+
+    pool.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    executors::Submit(pool, [&wg] {
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(FanOut) {
+    executors::ThreadPool pool{4, TwoNodes()};
+
+    pool.Start();
+
+    static const size_t kTasks = 100500;
+
+    std::atomic<size_t> done{0};
+
+    executors::Submit(pool, [&] {
+      for (size_t i = 0; i < kTasks; ++i) {
+        executors::Submit(pool, [&] {
+          done.fetch_add(1);
+        });
+      }
+    });
+
+    pool.WaitIdle();
+
+    ASSERT_EQ(done.load(), kTasks);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(MoreNodesThanThreads) {
+    executors::ThreadPool pool{2, Topology{{{}, {}, {}, {}}}};
+
+    pool.Start();
+
+    static const size_t kTasks = 1000;
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      executors::Submit(pool, [&] {
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Detected) {
+    executors::ThreadPool pool{4, Topology::Detect()};
+
+    pool.Start();
+
+    static const size_t kTasks = 1000;
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kTasks);
+
+    for (size_t i = 0; i < kTasks; ++i) {
+      executors::Submit(pool, [&] {
+        std::this_thread::sleep_for(10us);
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -1,7 +1,9 @@
 #include <weave/executors/thread_pool.hpp>
 #include <weave/executors/manual.hpp>
 
+#include <weave/fibers/sched/blocking.hpp>
 #include <weave/fibers/sched/go.hpp>
+#include <weave/fibers/sched/suspend.hpp>
 #include <weave/fibers/sched/yield.hpp>
 #include <weave/threads/blocking/wait_group.hpp>
 
@@ -9,7 +11,11 @@
 
 #include <wheels/test/framework.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
 #include <thread>
+#include <vector>
 
 #if !defined(TWIST_FIBERS)
 
@@ -173,6 +179,200 @@ TEST_SUITE(Fibers) {
     ASSERT_EQ(scheduler_1.Drain(), 2);
     ASSERT_EQ(scheduler_2.Drain(), 3);
   }
+
+  SIMPLE_TEST(Switch) {
+    executors::ManualExecutor scheduler;
+
+    fibers::FiberHandle sleeper;
+    std::vector<int> steps;
+
+    fibers::Go(scheduler, [&] {
+      auto park = [&](fibers::FiberHandle handle) {
+        sleeper = handle;
+        return fibers::FiberHandle::Invalid();
+      };
+
+      fibers::Suspend(park);
+      steps.push_back(2);
+    });
+
+    fibers::Go(scheduler, [&] {
+      steps.push_back(1);
+      sleeper.Switch();
+      steps.push_back(3);
+    });
+
+    // sleeper runs inside the second task, which is then rescheduled
+    ASSERT_EQ(scheduler.Drain(), 3);
+    ASSERT_EQ(steps, std::vector<int>({1, 2, 3}));
+  }
+
+  SIMPLE_TEST(SwitchToOtherScheduler) {
+    executors::ManualExecutor scheduler_1;
+    executors::ManualExecutor scheduler_2;
+
+    fibers::FiberHandle sleeper;
+    bool woken = false;
+
+    fibers::Go(scheduler_1, [&] {
+      auto park = [&](fibers::FiberHandle handle) {
+        sleeper = handle;
+        return fibers::FiberHandle::Invalid();
+      };
+
+      fibers::Suspend(park);
+      woken = true;
+    });
+
+    scheduler_1.Drain();
+
+    fibers::Go(scheduler_2, [&] {
+      // can't run here, falls back to Schedule
+      sleeper.Switch();
+    });
+
+    ASSERT_EQ(scheduler_2.Drain(), 1);
+    ASSERT_FALSE(woken);
+
+    ASSERT_EQ(scheduler_1.Drain(), 1);
+    ASSERT_TRUE(woken);
+  }
+
+  SIMPLE_TEST(StackSize) {
+    executors::ManualExecutor scheduler;
+
+    size_t done = 0;
+
+    fibers::Go(scheduler, [&] {
+      fibers::Go([&] {
+        // deep enough for a tiny stack to overflow
+        char buffer[128 * 1024];
+        buffer[0] = 1;
+        done += buffer[0];
+      }, fibers::StackSize::Large());
+
+      fibers::Yield();
+      ++done;
+    }, fibers::StackSize::Tiny());
+
+    ASSERT_EQ(scheduler.Drain(), 3);
+    ASSERT_EQ(done, 2);
+  }
+
+  SIMPLE_TEST(Blocking) {
+    executors::ThreadPool scheduler{1};
+    scheduler.Start();
+
+    threads::blocking::WaitGroup unblock;
+    unblock.Add(1);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    size_t result = 0;
+
+    fibers::Go(scheduler, [&] {
+      // would deadlock a single worker if it blocked the thread
+      result = fibers::Blocking([&] {
+        unblock.Wait();
+        return 42;
+      });
+
+      wg.Done();
+    });
+
+    fibers::Go(scheduler, [&] {
+      unblock.Done();
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_EQ(result, 42);
+
+    // just a call outside of a fiber
+    ASSERT_EQ(fibers::Blocking([] {
+      return 7;
+    }), 7);
+
+    scheduler.Stop();
+  }
+
+  SIMPLE_TEST(BlockingThrows) {
+    executors::ThreadPool scheduler{1};
+    scheduler.Start();
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    bool caught = false;
+
+    fibers::Go(scheduler, [&] {
+      try {
+        fibers::Blocking([] {
+          throw std::runtime_error("Test");
+        });
+      } catch (std::runtime_error&) {
+        caught = true;
+      }
+
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_TRUE(caught);
+
+    // same outside of a fiber
+    ASSERT_THROW(fibers::Blocking([] {
+      throw std::runtime_error("Test");
+    }), std::runtime_error);
+
+    scheduler.Stop();
+  }
+
+  SIMPLE_TEST(BlockingThreadsCap) {
+    static const size_t kMaxThreads = 2;
+    static const size_t kCalls = 8;
+
+    fibers::SetMaxBlockingThreads(kMaxThreads);
+
+    executors::ThreadPool scheduler{1};
+    scheduler.Start();
+
+    std::atomic<size_t> running{0};
+    std::atomic<size_t> max_running{0};
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kCalls);
+
+    for (size_t i = 0; i < kCalls; ++i) {
+      fibers::Go(scheduler, [&] {
+        fibers::Blocking([&] {
+          size_t now = running.fetch_add(1) + 1;
+
+          size_t max = max_running.load();
+          while (now > max && !max_running.compare_exchange_weak(max, now)) {
+            ;
+          }
+
+          std::this_thread::sleep_for(std::chrono::milliseconds(20));
+          running.fetch_sub(1);
+        });
+
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    // the rest waited in the queue
+    ASSERT_LE(max_running.load(), kMaxThreads);
+
+    scheduler.Stop();
+
+    fibers::SetMaxBlockingThreads(128);
+  }
 }
 
 #endif
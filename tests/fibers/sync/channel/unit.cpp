@@ -15,6 +15,7 @@
 
 #include <chrono>
 #include <thread>
+#include <vector>
 
 #include <fmt/core.h>
 
@@ -212,6 +213,30 @@ TEST_SUITE(Channels) {
     ASSERT_TRUE(all_received);
   }
 
+  SIMPLE_TEST(SwitchToReceiver) {
+    executors::ManualExecutor manual;
+
+    fibers::Channel<int> ints{1};
+
+    std::vector<int> steps;
+
+    fibers::Go(manual, [&steps, ints]() mutable {
+      ASSERT_EQ(ints.Receive(), 7);
+      steps.push_back(1);
+    });
+
+    manual.Drain();
+
+    fibers::Go(manual, [&steps, ints]() mutable {
+      ints.Send(7);  // <-- Receiver runs right here
+      steps.push_back(2);
+    });
+
+    // sender task + rescheduled sender
+    ASSERT_EQ(manual.Drain(), 2);
+    ASSERT_EQ(steps, std::vector<int>({1, 2}));
+  }
+
   SIMPLE_TEST(Fifo) {
     executors::ManualExecutor manual;
 
@@ -332,13 +357,15 @@ TEST_SUITE(Channels) {
           // std::cout << "Ping" << std::endl;
           xs.Send(1);
         }
+        // Send switches to a waiting receiver, so either side may
+        // observe the stop first: tell the other one explicitly
+        xs.Send(0);
         wg.Done();
       });
 
       fibers::Go([&]() {
         ys.Send(1);
-        while (!stop_requested.load()) {
-          xs.Receive();
+        while (xs.Receive() != 0) {
           // std::cout << "Pong" << std::endl;
           ys.Send(1);
         }
@@ -0,0 +1,173 @@
+#include <weave/futures/make/io.hpp>
+
+#include <weave/futures/combine/seq/on_cancel.hpp>
+#include <weave/futures/combine/seq/on_success.hpp>
+#include <weave/futures/combine/seq/start.hpp>
+
+#include <weave/futures/run/await.hpp>
+#include <weave/futures/run/detach.hpp>
+
+#include <weave/io/engines/thread_pool.hpp>
+#include <weave/io/engines/uring.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <chrono>
+#include <cstdio>
+#include <string_view>
+#include <thread>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if !defined(TWIST_FIBERS) && LINUX
+
+using namespace weave; // NOLINT
+
+using namespace std::chrono_literals;
+
+static int TempFile() {
+  char path[] = "/tmp/weave_io_XXXXXX";
+  int fd = ::mkstemp(path);
+  ::unlink(path);
+  return fd;
+}
+
+static void ReadWrite(io::IEngine& engine) {
+  int fd = TempFile();
+  ASSERT_GE(fd, 0);
+
+  std::string_view data = "Hello, world!";
+
+  auto written = futures::io::Write(engine, fd, data, 0) | futures::Await();
+  ASSERT_TRUE(written);
+  ASSERT_EQ(*written, data.size());
+
+  ASSERT_TRUE(futures::io::Fsync(engine, fd) | futures::Await());
+
+  char buffer[5];
+
+  auto read = futures::io::Read(engine, fd, buffer, 7) | futures::Await();
+  ASSERT_TRUE(read);
+  ASSERT_EQ(std::string_view(buffer, *read), "world");
+
+  ::close(fd);
+}
+
+static void ManyReads(io::IEngine& engine) {
+  int fd = TempFile();
+  ASSERT_GE(fd, 0);
+
+  static const size_t kReads = 1000;
+
+  char data[kReads];
+  for (size_t i = 0; i < kReads; ++i) {
+    data[i] = static_cast<char>(i);
+  }
+
+  ASSERT_TRUE(futures::io::Write(engine, fd, data, 0) | futures::Await());
+
+  char buffer[kReads];
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(kReads);
+
+  for (size_t i = 0; i < kReads; ++i) {
+    futures::io::Read(engine, fd, {buffer + i, 1}, i) |
+        futures::OnSuccess([&] {
+          wg.Done();
+        }) |
+        futures::Detach();
+  }
+
+  wg.Wait();
+
+  for (size_t i = 0; i < kReads; ++i) {
+    ASSERT_EQ(buffer[i], data[i]);
+  }
+
+  ::close(fd);
+}
+
+TEST_SUITE(IoEngines) {
+  SIMPLE_TEST(ThreadPoolReadWrite) {
+    io::ThreadPoolEngine engine{2};
+    ReadWrite(engine);
+  }
+
+  SIMPLE_TEST(ThreadPoolManyReads) {
+    io::ThreadPoolEngine engine{2};
+    ManyReads(engine);
+  }
+
+  SIMPLE_TEST(UringReadWrite) {
+    if (auto engine = io::UringEngine::TryCreate()) {
+      ReadWrite(*engine);
+    }
+  }
+
+  SIMPLE_TEST(UringManyReads) {
+    if (auto engine = io::UringEngine::TryCreate(64)) {
+      ManyReads(*engine);
+    }
+  }
+
+  SIMPLE_TEST(UringTinyRing) {
+    // Wakeup read competes with requests for the submission ring
+    if (auto engine = io::UringEngine::TryCreate(1)) {
+      ManyReads(*engine);
+    }
+  }
+
+  SIMPLE_TEST(UringCancel) {
+    auto engine = io::UringEngine::TryCreate();
+
+    if (!engine) {
+      return;
+    }
+
+    // read from an empty pipe never completes on its own
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    char buffer[8];
+
+    auto f = futures::io::Read(*engine, fds[0], buffer, -1) |
+             futures::OnSuccess([] {
+               ASSERT_TRUE(false);
+             }) |
+             futures::OnCancel([&] {
+               wg.Done();
+             }) |
+             futures::Start();
+
+    std::this_thread::sleep_for(100ms);
+
+    std::move(f).RequestCancel();
+
+    wg.Wait();
+
+    ::close(fds[0]);
+    ::close(fds[1]);
+  }
+
+  SIMPLE_TEST(Errors) {
+    io::ThreadPoolEngine engine{1};
+
+    char buffer[8];
+
+    auto read = futures::io::Read(engine, -1, buffer, 0) | futures::Await();
+
+    ASSERT_FALSE(read);
+    ASSERT_EQ(read.error().value(), EBADF);
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
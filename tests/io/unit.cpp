@@ -0,0 +1,166 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+
+#include <weave/io/async_fd.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <string>
+#include <string_view>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#if !defined(TWIST_FIBERS) && LINUX
+
+using namespace weave; // NOLINT
+
+TEST_SUITE(Reactor) {
+  SIMPLE_TEST(Pipe) {
+    io::Reactor reactor;
+
+    executors::ThreadPool scheduler{2};
+    scheduler.Start();
+
+    int fds[2];
+    ASSERT_EQ(::pipe(fds), 0);
+
+    io::AsyncFd reader(reactor, fds[0]);
+    io::AsyncFd writer(reactor, fds[1]);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(2);
+
+    std::string received;
+
+    fibers::Go(scheduler, [&] {
+      char buffer[7];
+
+      while (true) {
+        auto bytes = reader.Read(buffer);
+        ASSERT_TRUE(bytes);
+
+        if (*bytes == 0) {
+          break;
+        }
+
+        received.append(buffer, *bytes);
+      }
+
+      wg.Done();
+    });
+
+    fibers::Go(scheduler, [&] {
+      std::string_view hello = "Hello";
+
+      for (size_t i = 0; i < 1000; ++i) {
+        ASSERT_TRUE(writer.WriteAll(hello));
+      }
+
+      writer.Close();
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_EQ(received.size(), 5000);
+
+    scheduler.Stop();
+  }
+
+  SIMPLE_TEST(Echo) {
+    io::Reactor reactor;
+
+    executors::ThreadPool scheduler{1};
+    scheduler.Start();
+
+    int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in address{};
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port = 0;
+
+    socklen_t address_size = sizeof(address);
+
+    ASSERT_EQ(::bind(listen_fd, reinterpret_cast<sockaddr*>(&address),
+                     address_size), 0);
+    ASSERT_EQ(::listen(listen_fd, 16), 0);
+    ::getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address),
+                  &address_size);
+
+    io::AsyncFd listener(reactor, listen_fd);
+
+    static const size_t kClients = 8;
+    static const size_t kRounds = 100;
+
+    fibers::Go(scheduler, [&] {
+      for (size_t i = 0; i < kClients; ++i) {
+        auto client = listener.Accept();
+        ASSERT_TRUE(client);
+
+        fibers::Go([conn = std::move(*client)]() mutable {
+          char buffer[64];
+
+          while (true) {
+            auto bytes = conn.Read(buffer);
+
+            if (!bytes || *bytes == 0) {
+              return;
+            }
+
+            if (!conn.WriteAll({buffer, *bytes})) {
+              return;
+            }
+          }
+        });
+      }
+    });
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(kClients);
+
+    for (size_t i = 0; i < kClients; ++i) {
+      fibers::Go(scheduler, [&] {
+        io::AsyncFd socket(reactor, ::socket(AF_INET, SOCK_STREAM, 0));
+
+        ASSERT_TRUE(socket.Connect(reinterpret_cast<sockaddr*>(&address),
+                                   address_size));
+
+        std::string_view ping = "ping";
+
+        for (size_t j = 0; j < kRounds; ++j) {
+          ASSERT_TRUE(socket.WriteAll(ping));
+
+          char buffer[4];
+          size_t received = 0;
+
+          while (received < 4) {
+            auto bytes = socket.Read({buffer + received, 4 - received});
+            ASSERT_TRUE(bytes && *bytes > 0);
+            received += *bytes;
+          }
+
+          ASSERT_EQ(std::string_view(buffer, 4), ping);
+        }
+
+        wg.Done();
+      });
+    }
+
+    wg.Wait();
+
+    listener.Close();
+
+    scheduler.WaitIdle();
+    scheduler.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
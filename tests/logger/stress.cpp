@@ -24,7 +24,7 @@ namespace tests {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-#if defined(__WEAVE_REALTIME__)
+#if defined(__WEAVE_METRICS__)
 
 void TestSpawners() {
   executors::ThreadPool pool{4};
@@ -109,7 +109,7 @@ void TestSpawners() {
 
 ////////////////////////////////////////////////////////////////////////////////
 
-#if defined(__WEAVE_REALTIME__)
+#if defined(__WEAVE_METRICS__)
 
 TEST_SUITE(ThreadPool) {
   TWIST_TEST(SpawnWithLogging, 10s) {
@@ -1,5 +1,10 @@
 #include <weave/satellite/logger.hpp>
 
+#include <weave/executors/tp/fast/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
 #include <fmt/core.h>
 
 #include <wheels/test/framework.hpp>
@@ -124,6 +129,183 @@ TEST_SUITE(Logger){
 
         ASSERT_TRUE((d1 == 42 && d2 == 43) || (d1 == 43 && d2 == 42)); // NOLINT
     }
+
+    SIMPLE_TEST(CompileTimeIds){
+        enum class Id : size_t { First, Second, Count };
+
+        satellite::Logger<true, false> logger({"First", "Second"}, 1);
+
+        auto* shard = logger.MakeShard(0);
+
+        shard->Increment(Id::Second, 3);
+        shard->Increment("First", 1);
+        shard->Increment(Id::First, 1);
+
+        auto data = logger.GatherMetrics().Data();
+
+        // ids keep the order of names
+        ASSERT_EQ(data[0].first, "First");
+        ASSERT_EQ(data[0].second, 2);
+        ASSERT_EQ(data[1].first, "Second");
+        ASSERT_EQ(data[1].second, 3);
+    }
+
+    SIMPLE_TEST(GatherWhileWriting){
+        enum class Id : size_t { Test, Count };
+
+        static const size_t kIncrements = 1'000'000;
+        static const size_t kShards = 2;
+
+        satellite::Logger<true, false> logger({"Test"}, kShards);
+
+        std::vector<std::thread> writers{};
+
+        for(size_t i = 0; i < kShards; i++){
+            auto* shard = logger.MakeShard(i);
+
+            writers.emplace_back([shard]{
+                for(size_t j = 0; j < kIncrements; ++j){
+                    shard->Increment(Id::Test, 1);
+                }
+            });
+        }
+
+        size_t prev = 0;
+
+        while(prev != kShards * kIncrements){
+            auto [_, count] = logger.GatherMetrics().Data()[0];
+
+            ASSERT_GE(count, prev);
+            ASSERT_LE(count, kShards * kIncrements);
+            prev = count;
+        }
+
+        for(auto& th : writers){
+            th.join();
+        }
+    }
+
+    SIMPLE_TEST(Histograms){
+        satellite::Logger<true, false> logger({"Test"}, 2, {"Latency"});
+
+        auto* first = logger.MakeShard(0);
+        auto* second = logger.MakeShard(1);
+
+        for(uint64_t i = 1; i <= 100; ++i){
+            first->Record("Latency", i);
+        }
+        second->Record("Latency", 1'000'000);
+
+        auto histograms = logger.GatherMetrics().Histograms();
+
+        ASSERT_EQ(histograms.size(), 1);
+
+        auto [name, histogram] = histograms[0];
+
+        ASSERT_EQ(name, "Latency");
+        ASSERT_EQ(histogram.Count(), 101);
+        ASSERT_TRUE(histogram.Percentile(50) >= 50);
+        ASSERT_TRUE(histogram.Percentile(50) <= 55);
+        ASSERT_TRUE(histogram.Max() >= 1'000'000);
+    }
+
+    SIMPLE_TEST(TransparentHistograms){
+        enum class Id : size_t { Latency };
+
+        satellite::Logger<false, false> logger({"Test"}, 1, {"Latency"});
+
+        logger.MakeShard(0)->Record("Latency", 1);
+        logger.MakeShard(0)->Record(Id::Latency, 1);
+        logger.MakeShard(0)->Increment(Id::Latency, 1);
+
+        ASSERT_EQ(logger.GatherMetrics().Histograms(), Unit{});
+    }
 }
 
+TEST_SUITE(Histogram){
+    SIMPLE_TEST(Buckets){
+        using satellite::Histogram;
+
+        // small values are exact
+        for(uint64_t i = 0; i < 2 * Histogram::kSubBuckets; ++i){
+            ASSERT_EQ(Histogram::BucketOf(i), i);
+            ASSERT_EQ(Histogram::UpperBound(i), i);
+        }
+
+        ASSERT_EQ(Histogram::BucketOf(~uint64_t{0}), Histogram::kBuckets - 1);
+        ASSERT_EQ(Histogram::UpperBound(Histogram::kBuckets - 1), ~uint64_t{0});
+
+        for(uint64_t value = 1; value < (uint64_t{1} << 40); value = value * 3 + 1){
+            size_t bucket = Histogram::BucketOf(value);
+
+            ASSERT_TRUE(value <= Histogram::UpperBound(bucket));
+            ASSERT_TRUE(Histogram::UpperBound(bucket - 1) < value);
+            // relative error
+            ASSERT_TRUE(Histogram::UpperBound(bucket) - value <= value / Histogram::kSubBuckets);
+        }
+    }
+
+    SIMPLE_TEST(Percentiles){
+        satellite::HistogramRecorder recorder;
+
+        ASSERT_EQ(satellite::Histogram{}.Percentile(99), 0);
+
+        for(uint64_t i = 0; i < 1000; ++i){
+            recorder.Record(i < 990 ? 10 : 5000);
+        }
+
+        satellite::Histogram histogram;
+        recorder.AddTo(histogram);
+
+        ASSERT_EQ(histogram.Count(), 1000);
+        ASSERT_EQ(histogram.Percentile(50), 10);
+        ASSERT_EQ(histogram.Percentile(99), 10);
+        ASSERT_TRUE(histogram.Percentile(99.9) >= 5000);
+        ASSERT_TRUE(histogram.Max() < 5000 + 5000 / 8);
+    }
+}
+
+#if defined(__WEAVE_LATENCY_TRACING__)
+
+TEST_SUITE(LatencyTracing){
+    SIMPLE_TEST(GatherWhileRunning){
+        executors::tp::fast::ThreadPool pool{4};
+        pool.Start();
+
+        static const size_t kTasks = 100'000;
+
+        threads::blocking::WaitGroup wg;
+        wg.Add(kTasks);
+
+        std::thread watcher([&pool]{
+            for(size_t i = 0; i < 100; ++i){
+                pool.LatencyHistograms();
+            }
+        });
+
+        for(size_t i = 0; i < kTasks; ++i){
+            executors::Submit(pool, [&]{
+                executors::Submit(pool, [&]{
+                    wg.Done();
+                });
+            });
+        }
+
+        wg.Wait();
+        watcher.join();
+
+        pool.Stop();
+
+        uint64_t traced = 0;
+        for(auto& [name, histogram] : pool.Metrics().Histograms()){
+            traced += histogram.Count();
+        }
+
+        // every task is traced once
+        ASSERT_EQ(traced, 2 * kTasks);
+    }
+}
+
+#endif
+
 RUN_ALL_TESTS()
\ No newline at end of file
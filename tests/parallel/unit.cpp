@@ -0,0 +1,395 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+
+#include <weave/parallel/for.hpp>
+#include <weave/parallel/reduce.hpp>
+#include <weave/parallel/scan.hpp>
+#include <weave/parallel/sort.hpp>
+#include <weave/parallel/transform.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using executors::ThreadPool;
+
+std::vector<int> RandomValues(size_t size, int seed = 42) {
+  std::mt19937 twister(seed);
+  std::uniform_int_distribution<int> values(-1'000'000, 1'000'000);
+
+  std::vector<int> result(size);
+  for (auto& value : result) {
+    value = values(twister);
+  }
+  return result;
+}
+
+// Runs routine in a fiber of the pool and waits for it
+template <typename F>
+void InFiber(ThreadPool& pool, F routine) {
+  threads::blocking::WaitGroup wg;
+  wg.Add(1);
+
+  fibers::Go(pool, [&] {
+    routine();
+    wg.Done();
+  });
+
+  wg.Wait();
+}
+
+TEST_SUITE(Parallel) {
+  SIMPLE_TEST(ForIndices) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<uint64_t> squares(100'000, 0);
+
+    parallel::For(pool, size_t{0}, squares.size(), [&](size_t i) {
+      squares[i] = i * i;
+    });
+
+    for (size_t i = 0; i < squares.size(); ++i) {
+      ASSERT_EQ(squares[i], i * i);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ForRange) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<int> values(100'000, 1);
+
+    parallel::For(pool, values, [](int& value) {
+      ++value;
+    });
+
+    ASSERT_TRUE(std::all_of(values.begin(), values.end(), [](int value) {
+      return value == 2;
+    }));
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ForEmpty) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<int> values;
+    size_t calls = 0;
+
+    parallel::For(pool, values, [&](int&) {
+      ++calls;
+    });
+    parallel::For(pool, 7, 7, [&](int) {
+      ++calls;
+    });
+    parallel::For(pool, 7, 3, [&](int) {
+      ++calls;
+    });
+
+    ASSERT_EQ(calls, 0);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ForNegativeIndices) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    twist::ed::stdlike::atomic<int64_t> sum{0};
+
+    parallel::For(pool, -500, 500, [&](int i) {
+      sum.fetch_add(i);
+    });
+
+    ASSERT_EQ(sum.load(), -500);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(EveryIndexOnce) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<twist::ed::stdlike::atomic<int>> visits(10'000);
+
+    // smallest grain forks the most
+    parallel::For(
+        pool, size_t{0}, visits.size(),
+        [&](size_t i) {
+          visits[i].fetch_add(1);
+        },
+        {.elements = 1});
+
+    for (auto& count : visits) {
+      ASSERT_EQ(count.load(), 1);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(UsesWorkers) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::set<std::thread::id> threads;
+    threads::blocking::SpinLock mutex;
+
+    parallel::For(
+        pool, 0, 64,
+        [&](int) {
+          std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+          std::lock_guard guard{mutex};
+          threads.insert(std::this_thread::get_id());
+        },
+        {.elements = 1});
+
+    ASSERT_TRUE(threads.size() > 1);
+    ASSERT_EQ(threads.count(std::this_thread::get_id()), 0);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(CallerHelps) {
+    ThreadPool pool{1};
+    pool.Start();
+
+    // Single worker: the fiber has to run its share and suspend,
+    // otherwise the forks would never run
+    InFiber(pool, [&] {
+      std::vector<int> values(100'000, 1);
+
+      parallel::For(
+          pool, values,
+          [](int& value) {
+            value *= 3;
+          },
+          {.elements = 16});
+
+      ASSERT_EQ(std::accumulate(values.begin(), values.end(), 0), 300'000);
+    });
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Nested) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    const size_t kRows = 64;
+    const size_t kColumns = 1000;
+
+    std::vector<int> matrix(kRows * kColumns, 0);
+
+    InFiber(pool, [&] {
+      parallel::For(
+          pool, size_t{0}, kRows,
+          [&](size_t row) {
+            parallel::For(pool, size_t{0}, kColumns, [&](size_t column) {
+              matrix[row * kColumns + column] = row + column;
+            });
+          },
+          {.elements = 1});
+    });
+
+    for (size_t row = 0; row < kRows; ++row) {
+      for (size_t column = 0; column < kColumns; ++column) {
+        ASSERT_EQ(matrix[row * kColumns + column], row + column);
+      }
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ThreadRunner) {
+    executors::tp::fast::ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<int> values(10'000, 1);
+
+    threads::blocking::WaitGroup wg;
+    wg.Add(1);
+
+    // Worker can not suspend, the call stays on it
+    executors::Submit(pool, [&] {
+      parallel::For(pool, values, [](int& value) {
+        ++value;
+      });
+      wg.Done();
+    });
+
+    wg.Wait();
+
+    ASSERT_EQ(std::accumulate(values.begin(), values.end(), 0), 20'000);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Reduce) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    auto values = RandomValues(1'000'000);
+
+    const int64_t expected =
+        std::accumulate(values.begin(), values.end(), int64_t{7});
+
+    ASSERT_EQ(parallel::Reduce(pool, values, int64_t{7}), expected);
+
+    const int max = parallel::Reduce(pool, values, INT32_MIN, [](int a, int b) {
+      return std::max(a, b);
+    });
+    ASSERT_EQ(max, *std::max_element(values.begin(), values.end()));
+
+    std::vector<int> empty;
+    ASSERT_EQ(parallel::Reduce(pool, empty, 5), 5);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Transform) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    auto values = RandomValues(500'000);
+
+    std::vector<std::string> strings(values.size());
+
+    auto end = parallel::Transform(pool, values, strings.begin(), [](int value) {
+      return std::to_string(value);
+    });
+
+    ASSERT_TRUE(end == strings.end());
+
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(strings[i], std::to_string(values[i]));
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Scan) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    for (size_t size : {0, 1, 2, 3, 17, 1000, 1'000'000}) {
+      auto values = RandomValues(size);
+
+      std::vector<int64_t> expected(size);
+      std::inclusive_scan(values.begin(), values.end(), expected.begin(),
+                          std::plus<>{}, int64_t{3});
+
+      std::vector<int64_t> prefix(size);
+      auto end = parallel::Scan(pool, values, prefix.begin(), int64_t{3});
+
+      ASSERT_TRUE(end == prefix.end());
+      ASSERT_TRUE(prefix == expected);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(ScanInPlace) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    std::vector<int64_t> values(100'000, 1);
+
+    parallel::Scan(pool, values, values.begin(), int64_t{0});
+
+    for (size_t i = 0; i < values.size(); ++i) {
+      ASSERT_EQ(values[i], i + 1);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(Sort) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    for (size_t size : {0, 1, 100, 16'385, 100'000, 1'000'003}) {
+      auto values = RandomValues(size, size);
+
+      auto expected = values;
+      std::sort(expected.begin(), expected.end());
+
+      parallel::Sort(pool, values);
+
+      ASSERT_TRUE(values == expected);
+    }
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(SortComparator) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    auto values = RandomValues(300'000);
+    // plenty of equal keys
+    for (auto& value : values) {
+      value %= 100;
+    }
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+
+    InFiber(pool, [&] {
+      parallel::Sort(pool, values, std::greater<>{});
+    });
+
+    ASSERT_TRUE(values == expected);
+
+    pool.Stop();
+  }
+
+  SIMPLE_TEST(SortStrings) {
+    ThreadPool pool{4};
+    pool.Start();
+
+    auto numbers = RandomValues(100'000);
+
+    std::vector<std::string> values;
+    for (int number : numbers) {
+      values.push_back(std::to_string(number));
+    }
+
+    auto expected = values;
+    std::sort(expected.begin(), expected.end());
+
+    parallel::Sort(pool, values);
+
+    ASSERT_TRUE(values == expected);
+
+    pool.Stop();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -0,0 +1,264 @@
+#include <weave/cancel/never.hpp>
+
+#include <weave/futures/make/after.hpp>
+
+#include <weave/futures/combine/seq/and_then.hpp>
+#include <weave/futures/combine/seq/on_cancel.hpp>
+#include <weave/futures/combine/seq/on_success.hpp>
+#include <weave/futures/combine/seq/start.hpp>
+
+#include <weave/futures/run/await.hpp>
+#include <weave/futures/run/discard.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <weave/timers/processors/standalone.hpp>
+
+#include <wheels/test/framework.hpp>
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#if !defined(TWIST_FIBERS)
+
+using namespace weave; // NOLINT
+
+using weave::timers::detail::TimingWheel;
+using weave::threads::blocking::WaitGroup;
+
+using namespace std::chrono_literals;
+
+TEST_SUITE(TimingWheel){
+  struct Tester : public timers::TimerBase {
+    explicit Tester(timers::Millis ms) : delay_(ms) {
+    }
+
+    timers::Millis GetDelay() override {
+      return delay_;
+    }
+
+    void Run() noexcept override {
+      runs++;
+    }
+
+    cancel::Token CancelToken() override {
+      return cancel::Never();
+    }
+
+    ~Tester() override = default;
+
+    timers::Millis delay_;
+    size_t runs = 0;
+  };
+
+  // Runs timers, returns how many there were
+  size_t RunAll(wheels::IntrusiveList<timers::TimerBase> timers) {
+    size_t count = 0;
+
+    while (timers.NonEmpty()) {
+      timers.PopFront()->Run();
+      count++;
+    }
+
+    return count;
+  }
+
+  SIMPLE_TEST(JustWorks) {
+    TimingWheel wheel;
+
+    Tester timer{5ms};
+    wheel.Push(&timer);
+
+    auto [timers, until_next] = wheel.GrabReadyTimers();
+
+    ASSERT_EQ(RunAll(std::move(timers)), 0);
+    ASSERT_TRUE(until_next.has_value());
+    ASSERT_LE(*until_next, 5ms + 1ms);
+
+    std::this_thread::sleep_for(10ms);
+
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), 1);
+    ASSERT_EQ(timer.runs, 1);
+    ASSERT_EQ(wheel.Size(), 0);
+  }
+
+  SIMPLE_TEST(Order) {
+    TimingWheel wheel;
+
+    std::vector<Tester> timers;
+    for (auto delay : {30ms, 1ms, 20ms, 10ms, 100ms}) {
+      timers.emplace_back(delay);
+    }
+
+    for (auto& timer : timers) {
+      wheel.Push(&timer);
+    }
+
+    std::vector<timers::Millis> fired;
+
+    while (fired.size() < timers.size()) {
+      auto [ready, until_next] = wheel.GrabReadyTimers();
+
+      while (ready.NonEmpty()) {
+        auto* timer = static_cast<Tester*>(ready.PopFront());
+        fired.push_back(timer->delay_);
+      }
+
+      if (until_next) {
+        std::this_thread::sleep_for(*until_next);
+      }
+    }
+
+    std::vector<timers::Millis> expected{1ms, 10ms, 20ms, 30ms, 100ms};
+    ASSERT_EQ(fired, expected);
+  }
+
+  SIMPLE_TEST(Cascade) {
+    TimingWheel wheel;
+
+    // level 2
+    Tester timer{4200ms};
+
+    auto start = std::chrono::steady_clock::now();
+
+    wheel.Push(&timer);
+
+    while (timer.runs == 0) {
+      auto [ready, until_next] = wheel.GrabReadyTimers();
+      RunAll(std::move(ready));
+
+      if (until_next) {
+        std::this_thread::sleep_for(*until_next);
+      }
+    }
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    ASSERT_GE(elapsed, 4200ms);
+    ASSERT_LE(elapsed, 4200ms + 100ms);
+  }
+
+  SIMPLE_TEST(VeryFar) {
+    TimingWheel wheel;
+
+    Tester timer{24h};
+    wheel.Push(&timer);
+
+    auto [ready, until_next] = wheel.GrabReadyTimers();
+
+    ASSERT_EQ(RunAll(std::move(ready)), 0);
+    ASSERT_TRUE(until_next.has_value());
+    ASSERT_EQ(wheel.Size(), 1);
+
+    ASSERT_EQ(RunAll(wheel.TakeAll()), 1);
+  }
+
+  SIMPLE_TEST(Cancel) {
+    TimingWheel wheel;
+
+    std::vector<Tester> timers(1000, Tester{1h});
+
+    for (auto& timer : timers) {
+      wheel.Push(&timer);
+    }
+
+    wheel.UpdateQueueState();
+    ASSERT_EQ(wheel.Size(), timers.size());
+
+    for (size_t i = 0; i < timers.size(); i += 2) {
+      wheel.PostCancelRequest(&timers[i]);
+    }
+
+    // Removed right away
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), timers.size() / 2);
+    ASSERT_EQ(wheel.Size(), timers.size() / 2);
+
+    ASSERT_EQ(RunAll(wheel.TakeAll()), timers.size() / 2);
+
+    for (auto& timer : timers) {
+      ASSERT_EQ(timer.runs, 1);
+    }
+  }
+
+  SIMPLE_TEST(CancelBeforePush) {
+    TimingWheel wheel;
+
+    Tester timer{1h};
+
+    wheel.PostCancelRequest(&timer);
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), 0);
+
+    wheel.Push(&timer);
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), 1);
+    ASSERT_EQ(wheel.Size(), 0);
+  }
+
+  SIMPLE_TEST(ExactlyOnce) {
+    TimingWheel wheel;
+
+    Tester timer{1ms};
+    wheel.Push(&timer);
+
+    std::this_thread::sleep_for(5ms);
+
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), 1);
+
+    // Too late
+    wheel.PostCancelRequest(&timer);
+    wheel.PostCancelRequest(&timer);
+
+    ASSERT_EQ(RunAll(wheel.GrabReadyTimers().first), 0);
+    ASSERT_EQ(timer.runs, 1);
+  }
+
+  SIMPLE_TEST(Processor) {
+    timers::StandaloneWheelProcessor proc{};
+
+    proc.MakeGlobal();
+
+    auto start = std::chrono::steady_clock::now();
+
+    futures::After(100ms) | futures::AndThen([&](Unit){
+      auto finish = std::chrono::steady_clock::now();
+
+      ASSERT_GE(finish - start, 100ms);
+      ASSERT_LE(finish - start, 100ms + 50ms);
+    }) | futures::Await();
+  }
+
+  SIMPLE_TEST(ProcessorCancel) {
+    timers::StandaloneWheelProcessor proc{};
+
+    WaitGroup wg;
+    wg.Add(2);
+
+    proc.MakeGlobal();
+
+    auto start = std::chrono::steady_clock::now();
+
+    // Cancelled before it is added
+    futures::After(1s) | futures::OnSuccess([]{
+      ASSERT_TRUE(false);
+    }) | futures::OnCancel([&]{
+      wg.Done();
+    }) | futures::Discard();
+
+    auto f = futures::After(5s) | futures::OnCancel([&]{
+      auto finish = std::chrono::steady_clock::now();
+
+      ASSERT_LE(finish - start, 100ms + 50ms);
+      wg.Done();
+    }) | futures::Start();
+
+    std::this_thread::sleep_for(100ms);
+
+    std::move(f).RequestCancel();
+
+    wg.Wait();
+  }
+}
+
+#endif
+
+RUN_ALL_TESTS()
@@ -1,7 +1,8 @@
 #pragma once
 
 #include <sure/context.hpp>
-#include <sure/stack/mmap.hpp>
+
+#include <wheels/memory/view.hpp>
 
 #include <function2/function2.hpp>
 
@@ -34,7 +35,7 @@ class Coroutine {
  public:
   template <typename Function>
   requires std::is_nothrow_invocable<Function>::value Coroutine(
-      Function function, sure::Stack* stack)
+      Function function, wheels::MutableMemView stack)
       : stack_(stack) {
     SetupExecutionContext(std::move(function));
   }
@@ -53,13 +54,13 @@ class Coroutine {
   void SetupExecutionContext(Function routine) {
     auto trampoline = TemplateTrampoline<Function>(std::move(routine), this);
 
-    callee_context_.Setup(stack_->MutView(), &trampoline);
+    callee_context_.Setup(stack_, &trampoline);
 
     caller_context_.SwitchTo(callee_context_);
   }
 
  private:
-  sure::Stack* stack_;
+  wheels::MutableMemView stack_;
   sure::ExecutionContext caller_context_;
   sure::ExecutionContext callee_context_;
   // in theory I can store this context in a static
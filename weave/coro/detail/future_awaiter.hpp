@@ -0,0 +1,88 @@
+#pragma once
+
+#include <weave/coro/detail/promise.hpp>
+
+#include <weave/futures/model/evaluation.hpp>
+#include <weave/futures/types/future.hpp>
+
+#include <weave/support/constructor_bases.hpp>
+
+#include <coroutine>
+#include <optional>
+
+namespace weave::coro::detail {
+
+// Consumes the future on behalf of the suspended task
+template <typename T>
+class FutureReceiver {
+ public:
+  explicit FutureReceiver(PromiseBase& promise)
+      : promise_(promise) {
+  }
+
+  // Completable
+  void Consume(futures::Output<T> o) noexcept {
+    res_.emplace(std::move(o.result));
+
+    promise_.Schedule(o.context.hint_);
+  }
+
+  // CancelSource
+  void Cancel(futures::Context) noexcept {
+    // resumed task will throw
+    promise_.Schedule();
+  }
+
+  cancel::Token CancelToken() {
+    return promise_.CancelToken();
+  }
+
+  Result<T> GetResult() {
+    if (res_.has_value() && !promise_.CancelToken().CancelRequested()) {
+      return std::move(*res_);
+    } else {
+      // Propagate cancellation
+      throw cancel::CancelledException{};
+    }
+  }
+
+ private:
+  PromiseBase& promise_;
+  std::optional<Result<T>> res_;
+};
+
+// co_await for futures, the evaluation lives right in the coroutine frame
+// Same contract as futures::Await: returns Result<T>,
+// throws cancel::CancelledException once the task is cancelled
+
+template <futures::SomeFuture Future>
+class FutureAwaiter final : public support::PinnedBase {
+  using ValueType = typename Future::ValueType;
+  using Receiver = FutureReceiver<ValueType>;
+
+ public:
+  FutureAwaiter(Future future, PromiseBase& promise)
+      : receiver_(promise),
+        eval_(std::move(future).Force(receiver_)) {
+  }
+
+  // Cancelled task does not start anything new
+  bool await_ready() {
+    return receiver_.CancelToken().CancelRequested();
+  }
+
+  void await_suspend(std::coroutine_handle<>) {
+    // we may be resumed before Start returns
+    eval_.Start();
+  }
+
+  Result<ValueType> await_resume() {
+    return receiver_.GetResult();
+  }
+
+ private:
+  Receiver receiver_;
+  futures::EvaluationType<Receiver, Future> eval_;
+};
+
+}  // namespace weave::coro::detail
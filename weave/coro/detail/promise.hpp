@@ -0,0 +1,170 @@
+#pragma once
+
+#include <weave/cancel/never.hpp>
+#include <weave/cancel/token.hpp>
+
+#include <weave/executors/executor.hpp>
+#include <weave/executors/task.hpp>
+
+#include <weave/executors/detail/task_pool.hpp>
+
+#include <weave/satellite/meta_data.hpp>
+#include <weave/satellite/satellite.hpp>
+
+#include <wheels/core/panic.hpp>
+
+#include <coroutine>
+#include <exception>
+
+namespace weave::coro::detail {
+
+// Learns that a top-level task has reached its final suspend point
+struct ICompletionListener {
+  // Frame is still alive, listener may destroy it
+  virtual void OnCompleted() noexcept = 0;
+
+ protected:
+  ~ICompletionListener() = default;
+};
+
+// Part of the promise which does not depend on the value type
+//
+// Promise is the executors::Task which resumes the coroutine,
+// so scheduling a resumption never allocates. A task always resumes
+// on its executor and with its cancel token set as satellite context
+
+class PromiseBase : public executors::Task {
+  struct FinalAwaiter {
+    bool await_ready() noexcept {
+      return false;
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<Promise> self) noexcept {
+      PromiseBase& promise = self.promise();
+      return promise.OnFinalSuspend();
+    }
+
+    void await_resume() noexcept {
+    }
+  };
+
+ public:
+  // Small frames come from the same free lists as submitted lambdas
+  static void* operator new(size_t size) {
+    if (size <= executors::detail::TaskPool::kMaxBlockSize) {
+      return executors::detail::TaskPool::Allocate(size);
+    }
+
+    return ::operator new(size);
+  }
+
+  static void operator delete(void* frame, size_t size) {
+    if (size <= executors::detail::TaskPool::kMaxBlockSize) {
+      executors::detail::TaskPool::Release(frame, size);
+    } else {
+      ::operator delete(frame);
+    }
+  }
+
+  // Tasks are lazy
+  std::suspend_always initial_suspend() noexcept {
+    return {};
+  }
+
+  FinalAwaiter final_suspend() noexcept {
+    return {};
+  }
+
+  void unhandled_exception() noexcept {
+    exception_ = std::current_exception();
+  }
+
+  void Bind(executors::IExecutor* executor, cancel::Token token) {
+    executor_ = executor;
+    token_ = token;
+  }
+
+  executors::IExecutor* Executor() const {
+    return executor_;
+  }
+
+  cancel::Token CancelToken() const {
+    return token_;
+  }
+
+  // Awaiting task, resumed right away once we are done
+  void SetContinuation(std::coroutine_handle<> continuation) {
+    continuation_ = continuation;
+  }
+
+  void SetListener(ICompletionListener* listener) {
+    listener_ = listener;
+  }
+
+  // Resume on our executor
+  void Schedule(
+      executors::SchedulerHint hint = executors::SchedulerHint::UpToYou) {
+    executor_->Submit(this, hint);
+  }
+
+  // executors::Task
+  void Run() noexcept override {
+    satellite::MetaData old = satellite::SetContext(executor_, token_);
+
+    // frame may be gone after that
+    self_.resume();
+
+    satellite::RestoreContext(std::move(old));
+  }
+
+ protected:
+  void SetHandle(std::coroutine_handle<> self) {
+    self_ = self;
+  }
+
+  void RethrowIfFailed() {
+    if (exception_) {
+      std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+  }
+
+ private:
+  std::coroutine_handle<> OnFinalSuspend() noexcept {
+    if (continuation_) {
+      return continuation_;
+    }
+
+    if (listener_ != nullptr) {
+      listener_->OnCompleted();
+    } else {
+      // Detached, nobody is going to look at the result
+      if (exception_) {
+        try {
+          std::rethrow_exception(exception_);
+        } catch (cancel::CancelledException) {
+          // Fine
+        } catch (...) {
+          WHEELS_PANIC("Unhandled exception in a detached coro::Task");
+        }
+      }
+
+      self_.destroy();
+    }
+
+    return std::noop_coroutine();
+  }
+
+ private:
+  std::coroutine_handle<> self_;
+  std::coroutine_handle<> continuation_;
+  ICompletionListener* listener_{nullptr};
+
+  executors::IExecutor* executor_{nullptr};
+  cancel::Token token_{cancel::Never()};
+
+  std::exception_ptr exception_;
+};
+
+}  // namespace weave::coro::detail
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <weave/coro/task.hpp>
+
+#include <weave/executors/executor.hpp>
+
+namespace weave::coro {
+
+// Fire and forget, frame is destroyed once the task is done
+// Cancellation is swallowed, any other exception is fatal
+
+template <typename T>
+void Go(executors::IExecutor& exe, Task<T> task) {
+  auto handle = std::move(task).Release();
+
+  auto& promise = handle.promise();
+  promise.Bind(&exe, cancel::Never());
+  promise.Schedule();
+}
+
+}  // namespace weave::coro
@@ -0,0 +1,138 @@
+#pragma once
+
+#include <weave/coro/task.hpp>
+
+#include <weave/executors/executor.hpp>
+
+#include <weave/futures/model/evaluation.hpp>
+#include <weave/futures/types/future.hpp>
+
+#include <weave/result/make/ok.hpp>
+#include <weave/result/types/unit.hpp>
+
+#include <weave/support/constructor_bases.hpp>
+
+#include <wheels/core/panic.hpp>
+
+#include <optional>
+#include <type_traits>
+
+namespace weave::coro {
+
+namespace detail {
+
+template <typename T>
+using FutureValueOf = std::conditional_t<std::is_void_v<T>, Unit, T>;
+
+// Lazy future which runs the task on `exe` once started
+// The task gets the cancel token of the consumer
+
+template <typename T>
+class [[nodiscard]] TaskFuture final : public support::NonCopyableBase {
+ public:
+  using ValueType = FutureValueOf<T>;
+
+  TaskFuture(executors::IExecutor& exe, Task<T> task)
+      : exe_(&exe),
+        task_(std::move(task)) {
+  }
+
+  // Movable
+  TaskFuture(TaskFuture&& that) noexcept
+      : exe_(that.exe_),
+        task_(std::move(that.task_)) {
+  }
+  TaskFuture& operator=(TaskFuture&&) = delete;
+
+ private:
+  template <futures::Consumer<ValueType> Cons>
+  class EvaluationFor final : public support::PinnedBase,
+                              private ICompletionListener {
+    friend class TaskFuture;
+
+    EvaluationFor(TaskFuture fut, Cons& consumer)
+        : exe_(fut.exe_),
+          handle_(std::move(fut.task_).Release()),
+          consumer_(consumer) {
+    }
+
+   public:
+    ~EvaluationFor() {
+      handle_.destroy();
+    }
+
+    void Start() {
+      if (consumer_.CancelToken().CancelRequested()) {
+        consumer_.Cancel(futures::Context{});
+        return;
+      }
+
+      auto& promise = handle_.promise();
+
+      promise.Bind(exe_, consumer_.CancelToken());
+      promise.SetListener(this);
+      promise.Schedule();
+    }
+
+   private:
+    // ICompletionListener
+    void OnCompleted() noexcept override {
+      futures::Context context{exe_, executors::SchedulerHint::UpToYou};
+
+      std::optional<ValueType> value;
+
+      try {
+        if constexpr (std::is_void_v<T>) {
+          handle_.promise().TakeValue();
+          value.emplace();
+        } else {
+          value.emplace(handle_.promise().TakeValue());
+        }
+      } catch (cancel::CancelledException) {
+        consumer_.Cancel(std::move(context));
+        return;
+      } catch (...) {
+        // Result has no room for exceptions, same as in coro::Go
+        WHEELS_PANIC(
+            "Unhandled exception in a coro::Task started by coro::Run");
+      }
+
+      futures::Complete<ValueType>(
+          consumer_, {result::Ok(std::move(*value)), std::move(context)});
+    }
+
+   private:
+    executors::IExecutor* exe_;
+    typename Task<T>::Handle handle_;
+    Cons& consumer_;
+  };
+
+ public:
+  template <futures::Consumer<ValueType> Cons>
+  futures::Evaluation<TaskFuture, Cons> auto Force(Cons& cons) {
+    return EvaluationFor<Cons>(std::move(*this), cons);
+  }
+
+  void Cancellable() {
+    // No-Op
+  }
+
+ private:
+  executors::IExecutor* exe_;
+  Task<T> task_;
+};
+
+}  // namespace detail
+
+// Bridges tasks and futures:
+//
+// auto f = coro::Run(pool, Fetch(url));
+// Result<Page> page = std::move(f) | futures::Await();
+
+template <typename T>
+futures::Future<detail::FutureValueOf<T>> auto Run(executors::IExecutor& exe,
+                                                   Task<T> task) {
+  return detail::TaskFuture<T>(exe, std::move(task));
+}
+
+}  // namespace weave::coro
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <weave/coro/core.hpp>
+#include <weave/coro/stack_allocator.hpp>
 
 #include <twist/ed/local/ptr.hpp>
 
@@ -13,7 +14,7 @@ class SimpleCoroutine {
  public:
   template <typename Function>
   explicit SimpleCoroutine(Function function)
-      : stack_(sure::Stack::AllocateBytes(kDefaultStackSize)),
+      : stack_(StackAllocator::Instance().Allocate(kDefaultStackSize)),
         impl_(
             [owner = this, function = std::move(function)]() mutable noexcept {
               try {
@@ -24,7 +25,11 @@ class SimpleCoroutine {
 
               owner->is_completed_ = true;
             },
-            &stack_) {
+            stack_.MutView()) {
+  }
+
+  ~SimpleCoroutine() {
+    StackAllocator::Instance().Release(std::move(stack_));
   }
 
   void Resume();
@@ -38,7 +43,7 @@ class SimpleCoroutine {
 
  private:
   std::optional<std::exception_ptr> exception_container_{std::nullopt};
-  sure::Stack stack_;
+  Stack stack_;
   Coroutine impl_;
   bool is_completed_{false};
 
@@ -0,0 +1,74 @@
+#include <weave/coro/stack.hpp>
+
+#include <wheels/core/assert.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <utility>
+
+namespace weave::coro {
+
+Stack Stack::Allocate(size_t at_least, bool guard_page) {
+  const size_t page = PageSize();
+  const size_t pages = (at_least + page - 1) / page + (guard_page ? 1 : 0);
+  const size_t mapped = pages * page;
+
+  void* start = mmap(/*addr=*/nullptr, mapped, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, /*fd=*/-1, /*offset=*/0);
+
+  WHEELS_VERIFY(start != MAP_FAILED, "Failed to mmap coroutine stack");
+
+  if (guard_page) {
+    // stack grows down, so the lowest page guards it
+    WHEELS_VERIFY(mprotect(start, page, PROT_NONE) == 0,
+                  "Failed to protect stack guard page");
+  }
+
+  return Stack((char*)start, mapped, guard_page);
+}
+
+Stack::Stack(Stack&& that) noexcept
+    : start_(std::exchange(that.start_, nullptr)),
+      mapped_(std::exchange(that.mapped_, 0)),
+      guard_page_(std::exchange(that.guard_page_, false)) {
+}
+
+Stack& Stack::operator=(Stack&& that) noexcept {
+  if (this != &that) {
+    Unmap();
+
+    start_ = std::exchange(that.start_, nullptr);
+    mapped_ = std::exchange(that.mapped_, 0);
+    guard_page_ = std::exchange(that.guard_page_, false);
+  }
+
+  return *this;
+}
+
+Stack::~Stack() {
+  Unmap();
+}
+
+wheels::MutableMemView Stack::MutView() {
+  const size_t guard = guard_page_ ? PageSize() : 0;
+  return {start_ + guard, mapped_ - guard};
+}
+
+size_t Stack::Size() const {
+  return mapped_ - (guard_page_ ? PageSize() : 0);
+}
+
+size_t Stack::PageSize() {
+  static const size_t page = sysconf(_SC_PAGESIZE);
+  return page;
+}
+
+void Stack::Unmap() {
+  if (start_ != nullptr) {
+    munmap(start_, mapped_);
+    start_ = nullptr;
+  }
+}
+
+}  // namespace weave::coro
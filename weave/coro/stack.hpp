@@ -0,0 +1,59 @@
+#pragma once
+
+#include <wheels/memory/view.hpp>
+
+#include <cstdlib>
+
+namespace weave::coro {
+
+// Anonymous mmap-ed memory for a coroutine stack
+// Optional PROT_NONE page below it turns stack overflow into SIGSEGV
+
+class Stack {
+ public:
+  Stack() = default;
+
+  // Rounds `at_least` up to whole pages
+  static Stack Allocate(size_t at_least, bool guard_page = true);
+
+  // Non-copyable
+  Stack(const Stack&) = delete;
+  Stack& operator=(const Stack&) = delete;
+
+  Stack(Stack&&) noexcept;
+  Stack& operator=(Stack&&) noexcept;
+
+  ~Stack();
+
+  // Usable part, guard page excluded
+  wheels::MutableMemView MutView();
+
+  // Usable bytes
+  size_t Size() const;
+
+  bool HasGuardPage() const {
+    return guard_page_;
+  }
+
+  bool IsValid() const {
+    return start_ != nullptr;
+  }
+
+  static size_t PageSize();
+
+ private:
+  Stack(char* start, size_t mapped, bool guard_page)
+      : start_(start),
+        mapped_(mapped),
+        guard_page_(guard_page) {
+  }
+
+  void Unmap();
+
+ private:
+  char* start_{nullptr};
+  size_t mapped_{0};
+  bool guard_page_{false};
+};
+
+}  // namespace weave::coro
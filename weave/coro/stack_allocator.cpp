@@ -0,0 +1,203 @@
+#include <weave/coro/stack_allocator.hpp>
+
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <algorithm>
+#include <utility>
+
+namespace weave::coro {
+
+static const size_t kNoClass = static_cast<size_t>(-1);
+
+//////////////////////////////////////////////////////////////////////
+
+struct LocalStackCache {
+  size_t generation{0};
+  std::vector<std::vector<Stack>> stacks{};
+
+  // Stacks of the class cached by this thread
+  std::vector<Stack>* Class(StackAllocator& owner, size_t klass) {
+    Sync(owner);
+    return &stacks[klass];
+  }
+
+  // Drops stacks left from the previous Configure
+  void Sync(StackAllocator& owner) {
+    const size_t current = owner.generation_.load(std::memory_order::acquire);
+
+    if (generation != current) {
+      for (auto& klass : stacks) {
+        for (auto& stack : klass) {
+          owner.retained_.fetch_sub(stack.Size(), std::memory_order::relaxed);
+          owner.Unmap(std::move(stack));
+        }
+      }
+
+      stacks.clear();
+      stacks.resize(owner.options_.size_classes.size());
+      generation = current;
+    }
+  }
+
+  // Stacks go to the shared pool when the thread exits
+  ~LocalStackCache() {
+    if (stacks.empty()) {
+      return;
+    }
+
+    StackAllocator& owner = StackAllocator::Instance();
+    Sync(owner);
+
+    threads::blocking::stdlike::LockGuard lock(owner.mutex_);
+
+    for (size_t i = 0; i < stacks.size(); ++i) {
+      for (auto& stack : stacks[i]) {
+        owner.pool_[i].push_back(std::move(stack));
+      }
+    }
+  }
+};
+
+#if !defined(TWIST_FIBERS)
+static thread_local LocalStackCache local_cache;
+#endif
+
+//////////////////////////////////////////////////////////////////////
+
+StackAllocator::StackAllocator()
+    : logger_(kStackMetrics, 1),
+      shard_(logger_.MakeShard(0)) {
+  Configure(Options{});
+}
+
+StackAllocator& StackAllocator::Instance() {
+  static StackAllocator instance;
+  return instance;
+}
+
+void StackAllocator::Configure(Options options) {
+  const size_t page = Stack::PageSize();
+
+  // classes are matched by exact size on Release
+  for (auto& size : options.size_classes) {
+    size = (size + page - 1) / page * page;
+  }
+
+  std::sort(options.size_classes.begin(), options.size_classes.end());
+  options.size_classes.erase(std::unique(options.size_classes.begin(),
+                                         options.size_classes.end()),
+                             options.size_classes.end());
+
+  {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    for (auto& klass : pool_) {
+      for (auto& stack : klass) {
+        retained_.fetch_sub(stack.Size(), std::memory_order::relaxed);
+        Unmap(std::move(stack));
+      }
+    }
+
+    options_ = std::move(options);
+
+    pool_.clear();
+    pool_.resize(options_.size_classes.size());
+
+    generation_.fetch_add(1, std::memory_order::release);
+  }
+
+#if !defined(TWIST_FIBERS)
+  // caches of other threads are dropped on their next access
+  local_cache.Sync(*this);
+#endif
+}
+
+Stack StackAllocator::Allocate(size_t at_least) {
+  const size_t klass = ClassOf(at_least);
+
+#if !defined(TWIST_FIBERS)
+  if (klass != kNoClass) {
+    // thread-local cache first
+    if (auto* stacks = local_cache.Class(*this, klass); !stacks->empty()) {
+      Stack stack = std::move(stacks->back());
+      stacks->pop_back();
+
+      retained_.fetch_sub(stack.Size(), std::memory_order::relaxed);
+      shard_->Increment(StackMetric::FromLocalCache, 1);
+
+      return stack;
+    }
+
+    // then the shared pool
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    if (auto& stacks = pool_[klass]; !stacks.empty()) {
+      Stack stack = std::move(stacks.back());
+      stacks.pop_back();
+
+      retained_.fetch_sub(stack.Size(), std::memory_order::relaxed);
+      shard_->Increment(StackMetric::FromGlobalPool, 1);
+
+      return stack;
+    }
+  }
+#endif
+
+  shard_->Increment(StackMetric::Mapped, 1);
+
+  return Stack::Allocate(
+      klass != kNoClass ? options_.size_classes[klass] : at_least,
+      options_.guard_pages);
+}
+
+void StackAllocator::Release(Stack stack) {
+  if (!stack.IsValid()) {
+    return;
+  }
+
+#if !defined(TWIST_FIBERS)
+  const size_t size = stack.Size();
+  const size_t klass = ClassOf(size);
+
+  const bool poolable = klass != kNoClass &&
+                        options_.size_classes[klass] == size &&
+                        stack.HasGuardPage() == options_.guard_pages;
+
+  if (poolable) {
+    if (retained_.fetch_add(size, std::memory_order::relaxed) + size <=
+        options_.max_retained_bytes) {
+      if (auto* stacks = local_cache.Class(*this, klass);
+          stacks->size() < options_.local_cache_size) {
+        stacks->push_back(std::move(stack));
+        return;
+      }
+
+      // local cache is full -> overflow to the shared pool
+      threads::blocking::stdlike::LockGuard lock(mutex_);
+      pool_[klass].push_back(std::move(stack));
+
+      return;
+    }
+
+    // over the cap
+    retained_.fetch_sub(size, std::memory_order::relaxed);
+  }
+#endif
+
+  Unmap(std::move(stack));
+}
+
+size_t StackAllocator::ClassOf(size_t bytes) const {
+  const auto& classes = options_.size_classes;
+
+  auto it = std::lower_bound(classes.begin(), classes.end(), bytes);
+
+  return it == classes.end() ? kNoClass : it - classes.begin();
+}
+
+void StackAllocator::Unmap(Stack /*stack*/) {
+  // ~Stack does munmap
+  shard_->Increment(StackMetric::Unmapped, 1);
+}
+
+}  // namespace weave::coro
@@ -0,0 +1,114 @@
+#pragma once
+
+#include <weave/coro/stack.hpp>
+
+#include <weave/satellite/logger.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <array>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace weave::coro {
+
+//////////////////////////////////////////////////////////////////////
+
+#if defined(__WEAVE_METRICS__)
+inline const bool kCollectStackMetrics = true;
+#else
+inline const bool kCollectStackMetrics = false;
+#endif
+
+// Compile-time ids of kStackMetrics
+enum class StackMetric : size_t {
+  FromLocalCache,
+  FromGlobalPool,
+  Mapped,
+  Unmapped,
+  Count
+};
+
+// Indexed by StackMetric
+inline constexpr std::array<std::string_view,
+                            static_cast<size_t>(StackMetric::Count)>
+    kStackMetricNames{"Stacks from local cache", "Stacks from global pool",
+                      "Stacks mmap-ed", "Stacks munmap-ed"};
+
+static_assert(!kStackMetricNames.back().empty(),
+              "Every StackMetric needs a name");
+
+inline const std::vector<std::string> kStackMetrics(kStackMetricNames.begin(),
+                                                    kStackMetricNames.end());
+
+//////////////////////////////////////////////////////////////////////
+
+// Recycles coroutine stacks instead of mmap/munmap per fiber
+// Thread-local caches per size class + shared overflow pool
+// Stacks which do not fit any class or the retention cap are unmapped
+
+class StackAllocator {
+ public:
+  // Stacks are touched by whatever thread releases them
+  using Logger = satellite::Logger<kCollectStackMetrics, true>;
+
+  struct Options {
+    // Requests are rounded up to the smallest class that fits
+    std::vector<size_t> size_classes{8 * 1024, 16 * 1024, 64 * 1024,
+                                     256 * 1024, 1024 * 1024};
+
+    bool guard_pages{true};
+
+    // Stacks kept by one thread per size class
+    size_t local_cache_size{16};
+
+    // Upper bound on memory held by caches and the pool together
+    size_t max_retained_bytes{64 * 1024 * 1024};
+  };
+
+  static StackAllocator& Instance();
+
+  // Drops retained stacks, call before creating fibers
+  void Configure(Options options);
+
+  Stack Allocate(size_t at_least);
+
+  void Release(Stack stack);
+
+  size_t RetainedBytes() const {
+    return retained_.load(std::memory_order::relaxed);
+  }
+
+  Logger::Metrics Metrics() {
+    return logger_.GatherMetrics();
+  }
+
+ private:
+  friend struct LocalStackCache;
+
+  StackAllocator();
+
+  // npos if none fits
+  size_t ClassOf(size_t bytes) const;
+
+  void Unmap(Stack stack);
+
+ private:
+  Options options_{};
+
+  // bumped by Configure, stale local caches drop their stacks
+  twist::ed::stdlike::atomic<size_t> generation_{0};
+
+  threads::blocking::SpinLock mutex_;
+  std::vector<std::vector<Stack>> pool_;  // guarded by mutex_
+
+  twist::ed::stdlike::atomic<size_t> retained_{0};
+
+  Logger logger_;
+  Logger::LoggerShard* shard_;
+};
+
+}  // namespace weave::coro
@@ -0,0 +1,156 @@
+#pragma once
+
+#include <weave/coro/detail/future_awaiter.hpp>
+#include <weave/coro/detail/promise.hpp>
+
+#include <weave/futures/types/future.hpp>
+
+#include <coroutine>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace weave::coro {
+
+template <typename T = void>
+class Task;
+
+namespace detail {
+
+template <typename T>
+class PromiseValue : public PromiseBase {
+ public:
+  template <typename U>
+  void return_value(U&& value) {
+    value_.emplace(std::forward<U>(value));
+  }
+
+  T TakeValue() {
+    RethrowIfFailed();
+    return std::move(*value_);
+  }
+
+ private:
+  std::optional<T> value_;
+};
+
+template <>
+class PromiseValue<void> : public PromiseBase {
+ public:
+  void return_void() {
+  }
+
+  void TakeValue() {
+    RethrowIfFailed();
+  }
+};
+
+template <typename T>
+class Promise final : public PromiseValue<T> {
+ public:
+  Task<T> get_return_object();
+
+  // co_await std::move(future) -> Result<T>
+  template <futures::SomeFuture Future>
+  FutureAwaiter<Future> await_transform(Future future) {
+    return {std::move(future), *this};
+  }
+
+  template <typename Awaitable>
+  requires(!futures::SomeFuture<std::remove_cvref_t<Awaitable>>)
+  Awaitable&& await_transform(Awaitable&& awaitable) {
+    return std::forward<Awaitable>(awaitable);
+  }
+};
+
+}  // namespace detail
+
+//////////////////////////////////////////////////////////////////////
+
+// Stackless coroutine: a frame of a few hundred bytes instead of a stack
+//
+// Lazy, does nothing until it is awaited by another task
+// or started with coro::Go / coro::Run. Awaited task runs on the executor
+// of the awaiting one and inherits its cancel token
+//
+// co_await std::move(future) returns Result<T>, a task awaited via
+// co_await std::move(task) returns T or rethrows what the task has thrown
+
+template <typename T>
+class [[nodiscard]] Task {
+ public:
+  using promise_type = detail::Promise<T>;
+  using Handle = std::coroutine_handle<promise_type>;
+
+ private:
+  struct Awaiter {
+    bool await_ready() noexcept {
+      return false;
+    }
+
+    template <typename Promise>
+    std::coroutine_handle<> await_suspend(
+        std::coroutine_handle<Promise> parent) noexcept {
+      detail::PromiseBase& promise = parent.promise();
+
+      child.promise().Bind(promise.Executor(), promise.CancelToken());
+      child.promise().SetContinuation(parent);
+
+      return child;
+    }
+
+    T await_resume() {
+      return child.promise().TakeValue();
+    }
+
+    Handle child;
+  };
+
+ public:
+  explicit Task(Handle handle)
+      : handle_(handle) {
+  }
+
+  // Movable
+  Task(Task&& that) noexcept
+      : handle_(std::exchange(that.handle_, nullptr)) {
+  }
+  Task& operator=(Task&&) = delete;
+
+  // Non-copyable
+  Task(const Task&) = delete;
+  Task& operator=(const Task&) = delete;
+
+  ~Task() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  Awaiter operator co_await() && noexcept {
+    return {handle_};
+  }
+
+  // Caller takes care of the frame
+  Handle Release() && {
+    return std::exchange(handle_, nullptr);
+  }
+
+ private:
+  Handle handle_;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <typename T>
+Task<T> Promise<T>::get_return_object() {
+  auto handle = std::coroutine_handle<Promise>::from_promise(*this);
+  this->SetHandle(handle);
+  return Task<T>{handle};
+}
+
+}  // namespace detail
+
+}  // namespace weave::coro
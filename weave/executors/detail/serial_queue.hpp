@@ -0,0 +1,90 @@
+#pragma once
+
+#include <weave/executors/task.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <cstdint>
+#include <limits>
+
+namespace weave::executors::detail {
+
+// Lock-free queue with a single consumer activation at a time,
+// same protocol as Strand: producers push onto a stack,
+// the first push into an idle queue schedules the consumer
+
+class SerialQueue {
+ public:
+  using Node = wheels::IntrusiveListNode<Task>;
+
+  // Returns true if the consumer has to be scheduled
+  bool Push(Task* task) {
+    Node* former_top = top_.load(std::memory_order::relaxed);
+
+    do {
+      task->next_ = former_top;
+      // seq_cst for the same reason as in Strand::Submit
+    } while (!top_.compare_exchange_weak(former_top, task,
+                                         std::memory_order::seq_cst,
+                                         std::memory_order::relaxed));
+
+    return former_top == Idle();
+  }
+
+  // Consumer only
+  // Steals pushed tasks and returns them in FIFO order
+  wheels::IntrusiveList<Task> TakeAll() {
+    Node* top = top_.exchange(Underway(), std::memory_order::acquire);
+
+    wheels::IntrusiveList<Task> tasks;
+
+    // reverse the stack
+    Node* bottom = nullptr;
+    while (top != Underway() && top != Idle()) {
+      Node* next = top->next_;
+      top->next_ = bottom;
+      bottom = top;
+      top = next;
+    }
+
+    while (bottom != nullptr) {
+      Node* next = bottom->next_;
+      bottom->next_ = nullptr;
+      tasks.PushBack(bottom);
+      bottom = next;
+    }
+
+    return tasks;
+  }
+
+  // Consumer only
+  // Returns false if there were pushes since the last TakeAll,
+  // consumer has to be scheduled again then
+  bool TryFinish() {
+    Node* expected = Underway();
+    // always an internal submit thus can be kept at release
+    return top_.compare_exchange_strong(expected, Idle(),
+                                        std::memory_order::release,
+                                        std::memory_order::relaxed);
+  }
+
+  // No consumer activation is scheduled or running,
+  // anything it did happens before the return
+  bool IsIdle() const {
+    return top_.load(std::memory_order::acquire) == Idle();
+  }
+
+ private:
+  static Node* Idle() {
+    return nullptr;
+  }
+
+  static Node* Underway() {
+    return reinterpret_cast<Node*>(std::numeric_limits<uintptr_t>::max());
+  }
+
+ private:
+  twist::ed::stdlike::atomic<Node*> top_{Idle()};
+};
+
+}  // namespace weave::executors::detail
@@ -0,0 +1,163 @@
+#include <weave/executors/detail/task_pool.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <algorithm>
+#include <new>
+
+namespace weave::executors::detail {
+
+//////////////////////////////////////////////////////////////////////
+
+// 64, 128, 256
+static const size_t kClasses = 3;
+
+// Blocks kept by a single thread per class
+static const size_t kLocalCacheSize = 256;
+
+// Left in a local cache after it overflows,
+// also the refill size on a miss
+static const size_t kTransferBatch = kLocalCacheSize / 2;
+
+// Blocks kept by the shared pool per class, the rest is freed
+static const size_t kMaxPooled = 64 * 1024;
+
+static size_t ClassOf(size_t size) {
+  if (size <= 64) {
+    return 0;
+  }
+
+  return size <= 128 ? 1 : 2;
+}
+
+static size_t ClassSize(size_t klass) {
+  return size_t{64} << klass;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct FreeList {
+  FreeBlock* head{nullptr};
+  size_t size{0};
+
+  void Push(void* memory) {
+    auto* block = static_cast<FreeBlock*>(memory);
+    block->next = head;
+    head = block;
+    ++size;
+  }
+
+  void* Pop() {
+    FreeBlock* block = head;
+    head = block->next;
+    --size;
+    return block;
+  }
+
+  // Moves up to `count` blocks from `that`
+  void Take(FreeList& that, size_t count) {
+    while (count-- > 0 && that.head != nullptr) {
+      Push(that.Pop());
+    }
+  }
+};
+
+//////////////////////////////////////////////////////////////////////
+
+struct SharedPool {
+  threads::blocking::SpinLock mutex;
+  FreeList lists[kClasses];  // guarded by mutex
+
+  // Never destroyed: thread-local caches flush here on thread exit
+  static SharedPool& Instance() {
+    static SharedPool* instance = new SharedPool{};
+    return *instance;
+  }
+};
+
+struct LocalTaskCache {
+  FreeList lists[kClasses];
+
+  ~LocalTaskCache() {
+    SharedPool& pool = SharedPool::Instance();
+
+    for (size_t klass = 0; klass < kClasses; ++klass) {
+      FreeList& list = lists[klass];
+
+      threads::blocking::stdlike::LockGuard lock(pool.mutex);
+
+      while (list.head != nullptr &&
+             pool.lists[klass].size < kMaxPooled) {
+        pool.lists[klass].Push(list.Pop());
+      }
+
+      while (list.head != nullptr) {
+        ::operator delete(list.Pop());
+      }
+    }
+  }
+};
+
+#if !defined(TWIST_FIBERS)
+static thread_local LocalTaskCache local_cache;
+#endif
+
+//////////////////////////////////////////////////////////////////////
+
+void* TaskPool::Allocate(size_t size) {
+  const size_t klass = ClassOf(size);
+
+#if !defined(TWIST_FIBERS)
+  FreeList& local = local_cache.lists[klass];
+
+  if (local.head == nullptr) {
+    SharedPool& pool = SharedPool::Instance();
+
+    threads::blocking::stdlike::LockGuard lock(pool.mutex);
+    local.Take(pool.lists[klass], kTransferBatch);
+  }
+
+  if (local.head != nullptr) {
+    return local.Pop();
+  }
+#endif
+
+  return ::operator new(ClassSize(klass));
+}
+
+void TaskPool::Release(void* block, size_t size) {
+#if !defined(TWIST_FIBERS)
+  const size_t klass = ClassOf(size);
+
+  FreeList& local = local_cache.lists[klass];
+
+  local.Push(block);
+
+  if (local.size > kLocalCacheSize) {
+    SharedPool& pool = SharedPool::Instance();
+
+    {
+      threads::blocking::stdlike::LockGuard lock(pool.mutex);
+
+      FreeList& shared = pool.lists[klass];
+      shared.Take(local, std::min(local.size - kTransferBatch,
+                                  kMaxPooled - shared.size));
+    }
+
+    // shared pool is full
+    while (local.size > kTransferBatch) {
+      ::operator delete(local.Pop());
+    }
+  }
+#else
+  (void)size;
+  ::operator delete(block);
+#endif
+}
+
+}  // namespace weave::executors::detail
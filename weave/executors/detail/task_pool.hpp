@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdlib>
+
+namespace weave::executors::detail {
+
+// Recycles memory of fire-and-forget tasks
+// Thread-local free lists per size class + shared overflow pool,
+// so a task allocated by one thread and run by another
+// eventually finds its way back to submitters
+
+class TaskPool {
+ public:
+  // Larger tasks go straight to operator new
+  static const size_t kMaxBlockSize = 256;
+
+  static void* Allocate(size_t size);
+
+  static void Release(void* block, size_t size);
+};
+
+}  // namespace weave::executors::detail
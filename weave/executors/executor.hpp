@@ -14,6 +14,15 @@ struct IExecutor {
   virtual void Submit(Task* task,
                       SchedulerHint hint = SchedulerHint::UpToYou) = 0;
 
+  // Submits every task from `tasks` in order, leaves `tasks` empty
+  // Schedulers override it to pay for queueing and wakeups once per batch
+  virtual void SubmitBatch(wheels::IntrusiveList<Task>& tasks,
+                           SchedulerHint hint = SchedulerHint::UpToYou) {
+    while (Task* task = tasks.PopFront()) {
+      Submit(task, hint);
+    }
+  }
+
   virtual bool IRunFibers() {
     return false;
   }
@@ -14,6 +14,11 @@ void ManualExecutor::Submit(Task* task, SchedulerHint) {
   queue_.PushBack(task);
 }
 
+void ManualExecutor::SubmitBatch(wheels::IntrusiveList<Task>& tasks,
+                                 SchedulerHint) {
+  queue_.Append(tasks);
+}
+
 size_t ManualExecutor::RunAtMost(size_t limit) {
   limit_ = limit;
   while (limit_ > 0 && queue_.HasItems()) {
@@ -27,6 +27,9 @@ class ManualExecutor : public IExecutor {
   // IExecutor
   void Submit(Task*, SchedulerHint hint = SchedulerHint::UpToYou) override;
 
+  void SubmitBatch(wheels::IntrusiveList<Task>&,
+                   SchedulerHint hint = SchedulerHint::UpToYou) override;
+
   bool IRunFibers() override {
     return true;
   }
@@ -8,19 +8,79 @@
 
 #include <twist/ed/local/ptr.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+
 namespace weave::executors::runners {
 
 TWISTED_THREAD_LOCAL_PTR(FiberRunnerShard, current);
 
 void FiberRunner::RunnerRoutine(IPicker& picker) {
   // this stack frame exists until stop is requested
-  FiberRunnerShard shard(&picker);
+  FiberRunnerShard shard(&picker, slice_);
   current = &shard;
 
+  SliceTracker::SetCurrent(shard.Tracker());
+  Register(shard.Tracker());
+
   shard.Run();
   // unreachable until StopRequested() == true;
 
   shard.Stop();
+
+  Unregister(shard.Tracker());
+  SliceTracker::SetCurrent(nullptr);
+}
+
+void FiberRunner::SetTimeSlice(weave::fibers::TimeSlice slice) {
+  slice_ = slice;
+
+  if (SlicingEnabled() && slice_.watchdog && !watchdog_) {
+    watchdog_.emplace([this] {
+      WatchdogRoutine();
+    });
+  }
+}
+
+FiberRunner::~FiberRunner() {
+  if (watchdog_) {
+    stop_watchdog_.store(true, std::memory_order::relaxed);
+    watchdog_->join();
+  }
+}
+
+void FiberRunner::Register(SliceTracker* tracker) {
+  if (tracker != nullptr) {
+    std::lock_guard lock(mutex_);
+    trackers_.push_back(tracker);
+  }
+}
+
+void FiberRunner::Unregister(SliceTracker* tracker) {
+  if (tracker != nullptr) {
+    std::lock_guard lock(mutex_);
+    std::erase(trackers_, tracker);
+  }
+}
+
+void FiberRunner::WatchdogRoutine() {
+  // a slice overruns by at most half of the budget before it's noticed
+  const auto period =
+      std::max(slice_.budget / 2, std::chrono::microseconds(50));
+
+  while (!stop_watchdog_.load(std::memory_order::relaxed)) {
+    {
+      std::lock_guard lock(mutex_);
+
+      const int64_t now = SliceTracker::Now();
+      for (SliceTracker* tracker : trackers_) {
+        tracker->Inspect(now);
+      }
+    }
+
+    twist::ed::stdlike::this_thread::sleep_for(period);
+  }
 }
 
 //////////////////////////////////////////////////////////////////////
@@ -53,6 +113,11 @@ void FiberRunnerShard::CarrierRoutine() {
     while (Task* task = owner->picker_->PickTask()) {
       auto epoch = carrier->GetEpoch();
 
+      // every task gets a fresh slice
+      if (SliceTracker* tracker = SliceTracker::Current()) {
+        tracker->Restart();
+      }
+
       task->Run();
       //
       if (epoch != carrier->GetEpoch()) {
@@ -1,32 +1,70 @@
 #pragma once
 
 #include <weave/fibers/core/fwd.hpp>
+#include <weave/fibers/core/time_slice.hpp>
 
 #include <weave/executors/tp/fast/runner.hpp>
 
 #include <weave/executors/executor.hpp>
 
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
 #include <wheels/intrusive/list.hpp>
 
+#include <optional>
+#include <vector>
+
 namespace weave::executors::runners {
 
 class FiberRunner : public IRunner {
   using Fiber = weave::fibers::Fiber;
+  using SliceTracker = weave::fibers::SliceTracker;
 
  public:
   void RunnerRoutine(IPicker& picker) override;
 
-  ~FiberRunner() override = default;
+  // Call before Start
+  void SetTimeSlice(weave::fibers::TimeSlice slice);
+
+  ~FiberRunner() override;
+
+ private:
+  bool SlicingEnabled() const {
+    return slice_.budget.count() > 0;
+  }
+
+  void Register(SliceTracker* tracker);
+  void Unregister(SliceTracker* tracker);
+
+  // Raises preemption requests for overrunning slices
+  void WatchdogRoutine();
+
+ private:
+  weave::fibers::TimeSlice slice_{};
+
+  threads::blocking::stdlike::Mutex mutex_;
+  std::vector<SliceTracker*> trackers_;  // guarded by mutex_
+
+  twist::ed::stdlike::atomic<bool> stop_watchdog_{false};
+  std::optional<twist::ed::stdlike::thread> watchdog_;
 };
 
 /////////////////////////////////////////////////////////////////////
 
 class FiberRunnerShard {
   using Fiber = weave::fibers::Fiber;
+  using SliceTracker = weave::fibers::SliceTracker;
 
  public:
-  explicit FiberRunnerShard(IPicker* picker)
+  explicit FiberRunnerShard(IPicker* picker,
+                            weave::fibers::TimeSlice slice = {})
       : picker_(picker) {
+    if (slice.budget.count() > 0) {
+      tracker_.emplace(slice);
+    }
   }
 
   void Run();
@@ -37,6 +75,11 @@ class FiberRunnerShard {
 
   void RetireAsCarrier(Fiber* carrier);
 
+  // nullptr if slicing is off
+  SliceTracker* Tracker() {
+    return tracker_ ? &*tracker_ : nullptr;
+  }
+
  private:
   Fiber* GetCarrier();
 
@@ -50,6 +93,8 @@ class FiberRunnerShard {
   bool stopped_{false};
   IPicker* picker_;
   wheels::IntrusiveList<Fiber> pool_{};
+
+  std::optional<SliceTracker> tracker_;
 };
 
 }  // namespace weave::executors::runners
\ No newline at end of file
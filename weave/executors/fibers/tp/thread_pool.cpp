@@ -8,4 +8,10 @@ ThreadPool::ThreadPool(size_t threads)
   SetRunner(*this);
 }
 
+ThreadPool::ThreadPool(size_t threads, tp::fast::Topology topology)
+    : runners::FiberRunner(),
+      executors::tp::fast::ThreadPool(threads, std::move(topology)) {
+  SetRunner(*this);
+}
+
 }  // namespace weave::executors::fibers
\ No newline at end of file
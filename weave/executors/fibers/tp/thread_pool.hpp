@@ -11,6 +11,8 @@ class ThreadPool final : private runners::FiberRunner,
  public:
   explicit ThreadPool(size_t threads);
 
+  ThreadPool(size_t threads, tp::fast::Topology topology);
+
   // Non-copyable
   ThreadPool(const ThreadPool&) = delete;
   ThreadPool& operator=(const ThreadPool&) = delete;
@@ -23,6 +25,12 @@ class ThreadPool final : private runners::FiberRunner,
     return true;
   }
 
+  // Bounds how long a task holds its worker, see weave::fibers::TimeSlice
+  // Call before Start
+  void SetTimeSlice(weave::fibers::TimeSlice slice) {
+    runners::FiberRunner::SetTimeSlice(slice);
+  }
+
   ~ThreadPool() override = default;
 };
 
@@ -0,0 +1,203 @@
+#pragma once
+
+#include <weave/executors/executor.hpp>
+#include <weave/executors/submit.hpp>
+#include <weave/executors/task.hpp>
+
+#include <weave/executors/detail/serial_queue.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace weave::executors {
+
+// Serial execution per key, different keys run in parallel
+//
+// Keys are hashed onto a fixed set of lanes. A lane is a lock-free
+// serial queue which hands tasks over to per-key queues,
+// those are created on first use and dropped once they are idle
+//
+// Must outlive submitted tasks
+
+template <typename Key, typename Hash = std::hash<Key>>
+class KeyedStrand {
+  static const size_t kMinSweepThreshold = 64;
+
+  // Base of the pooled detail::SubmitTask, lanes sort tasks by the key
+  class KeyedTaskBase : public Task {
+   public:
+    explicit KeyedTaskBase(Key key)
+        : key_(std::move(key)) {
+    }
+
+    const Key& GetKey() const {
+      return key_;
+    }
+
+   private:
+    Key key_;
+  };
+
+  // Tasks of a single key
+  class KeyQueue final : public Task {
+   public:
+    explicit KeyQueue(IExecutor& underlying)
+        : underlying_(underlying) {
+    }
+
+    void Push(Task* task) {
+      if (tasks_.Push(task)) {
+        underlying_.Submit(this, SchedulerHint::UpToYou);
+      }
+    }
+
+    bool IsIdle() const {
+      return tasks_.IsIdle();
+    }
+
+   private:
+    void Run() noexcept override {
+      wheels::IntrusiveList<Task> tasks = tasks_.TakeAll();
+
+      while (Task* task = tasks.PopFront()) {
+        task->Run();
+      }
+
+      if (!tasks_.TryFinish()) {
+        underlying_.Submit(this, SchedulerHint::UpToYou);
+      }
+      // lane may destroy us from now on
+    }
+
+   private:
+    IExecutor& underlying_;
+    detail::SerialQueue tasks_;
+  };
+
+  // Sorts incoming tasks into key queues
+  class alignas(64) Lane final : public Task {
+   public:
+    explicit Lane(IExecutor& underlying)
+        : underlying_(underlying) {
+    }
+
+    ~Lane() {
+      for (auto& [_, queue] : queues_) {
+        delete queue;
+      }
+    }
+
+    void Push(Task* task, SchedulerHint hint) {
+      if (incoming_.Push(task)) {
+        underlying_.Submit(this, hint);
+      }
+    }
+
+   private:
+    void Run() noexcept override {
+      wheels::IntrusiveList<Task> tasks = incoming_.TakeAll();
+
+      while (Task* task = tasks.PopFront()) {
+        auto* keyed = static_cast<KeyedTaskBase*>(task);
+        Materialize(keyed->GetKey())->Push(keyed);
+      }
+
+      MaybeSweep();
+
+      if (!incoming_.TryFinish()) {
+        underlying_.Submit(this, SchedulerHint::UpToYou);
+      }
+    }
+
+    KeyQueue* Materialize(const Key& key) {
+      auto [it, inserted] = queues_.try_emplace(key, nullptr);
+
+      if (inserted) {
+        it->second = new KeyQueue(underlying_);
+      }
+
+      return it->second;
+    }
+
+    // Drops idle key queues, amortized O(1) per created queue
+    void MaybeSweep() {
+      if (queues_.size() < sweep_at_) {
+        return;
+      }
+
+      std::erase_if(queues_, [](const auto& entry) {
+        if (entry.second->IsIdle()) {
+          delete entry.second;
+          return true;
+        }
+        return false;
+      });
+
+      sweep_at_ = std::max(kMinSweepThreshold, 2 * queues_.size());
+    }
+
+   private:
+    IExecutor& underlying_;
+    detail::SerialQueue incoming_;
+
+    // Only touched by Run
+    std::unordered_map<Key, KeyQueue*, Hash> queues_;
+    size_t sweep_at_{kMinSweepThreshold};
+  };
+
+ public:
+  // Number of lanes is rounded up to a power of two
+  explicit KeyedStrand(IExecutor& underlying, size_t lanes = 64,
+                       Hash hash = Hash{})
+      : underlying_(underlying),
+        hash_(std::move(hash)),
+        mask_(std::bit_ceil(std::max<size_t>(lanes, 1)) - 1),
+        lanes_(mask_ + 1) {
+    for (auto& lane : lanes_) {
+      lane = std::make_unique<Lane>(underlying_);
+    }
+  }
+
+  // Non-copyable
+  KeyedStrand(const KeyedStrand&) = delete;
+  KeyedStrand& operator=(const KeyedStrand&) = delete;
+
+  // Non-movable
+  KeyedStrand(KeyedStrand&&) = delete;
+  KeyedStrand& operator=(KeyedStrand&&) = delete;
+
+  // Tasks with equal keys run one at a time in submission order
+  template <typename F>
+  void Submit(Key key, F fun, SchedulerHint hint = SchedulerHint::UpToYou) {
+    Lane& lane = LaneFor(key);
+    lane.Push(detail::SubmitTask<F, KeyedTaskBase>::Make(
+                  underlying_, std::move(fun), std::move(key)),
+              hint);
+  }
+
+  size_t LaneCount() const {
+    return lanes_.size();
+  }
+
+ private:
+  Lane& LaneFor(const Key& key) {
+    // key queues inside a lane are hashed with the same function,
+    // take the upper bits to keep them spread
+    const uint64_t mixed =
+        static_cast<uint64_t>(hash_(key)) * 0x9E3779B97F4A7C15ull;
+    return *lanes_[(mixed >> 32) & mask_];
+  }
+
+ private:
+  IExecutor& underlying_;
+  Hash hash_;
+  const size_t mask_;
+  std::vector<std::unique_ptr<Lane>> lanes_;
+};
+
+}  // namespace weave::executors
@@ -6,6 +6,11 @@ void ManualExecutor::Submit(Task* task, SchedulerHint) {
   queue_.PushBack(task);
 }
 
+void ManualExecutor::SubmitBatch(wheels::IntrusiveList<Task>& tasks,
+                                 SchedulerHint) {
+  queue_.Append(tasks);
+}
+
 // Run tasks
 
 size_t ManualExecutor::RunAtMost(size_t limit) {
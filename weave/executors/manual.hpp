@@ -23,6 +23,8 @@ class ManualExecutor : public IExecutor {
   // IExecutor
   void Submit(Task*, SchedulerHint) override;
 
+  void SubmitBatch(wheels::IntrusiveList<Task>&, SchedulerHint) override;
+
   // Run tasks
 
   // Run at most `limit` tasks from queue
@@ -1,76 +1,232 @@
 #include <weave/executors/strand.hpp>
-#include <weave/executors/submit.hpp>
 
-#include <algorithm>
-#include <utility>
+#include <twist/ed/local/ptr.hpp>
+#include <twist/ed/wait/spin.hpp>
+
+#include <atomic>
 
 namespace weave::executors {
 
+// Runs underway on the current thread, innermost first
+struct RunFrame {
+  Strand* strand;
+  RunFrame* prev;
+  bool destroyed{false};
+};
+
+static twist::ed::ThreadLocalPtr<RunFrame> run_frames;
+
+struct RunFrameGuard {
+  explicit RunFrameGuard(RunFrame& frame) {
+    frame.prev = run_frames;
+    run_frames = &frame;
+  }
+
+  ~RunFrameGuard() {
+    run_frames = static_cast<RunFrame*>(run_frames)->prev;
+  }
+};
+
+// Task::next_ is a plain pointer, producers link through it concurrently
+// with the consumer reading it
+
+static Strand::Node* LoadNext(Strand::Node* node) {
+  return std::atomic_ref(node->next_).load(std::memory_order::acquire);
+}
+
+static void StoreNext(Strand::Node* node, Strand::Node* next) {
+  std::atomic_ref(node->next_).store(next, std::memory_order::release);
+}
+
+//////////////////////////////////////////////////////////////////////
+
 Strand::Strand(IExecutor& underlying)
+    : Strand(underlying, Budget{}) {
+}
+
+Strand::Strand(IExecutor& underlying, Budget budget)
     : underlying_(underlying),
-      stack_(std::make_shared<AtomicPtr>(nullptr)) {
+      budget_(budget),
+      logger_(kStrandMetrics, 1),
+      shard_(logger_.MakeShard(0)) {
+}
+
+Strand::~Strand() {
+  for (RunFrame* frame = run_frames; frame != nullptr; frame = frame->prev) {
+    if (frame->strand == this) {
+      // by our own task, Run must not touch us anymore
+      frame->destroyed = true;
+      return;
+    }
+  }
+
+  // Run may still be finishing on another thread,
+  // the last thing it touches is head_
+  while (head_.load(std::memory_order::acquire) != nullptr) {
+    twist::ed::CpuRelax();
+  }
 }
 
 void Strand::Submit(Task* task, SchedulerHint) {
-  Node* former_top = stack_->load(std::memory_order::relaxed);
-  // reading foul former_top doesn't cause anything so we are free to set
-  // relaxed
-
-  do {
-    task->next_ = former_top;
-    // seq_cst because it can be an external submit to ThreadPool
-    // which manipulates with TaskFlags thus must be cross_var hb
-  } while (!stack_->compare_exchange_weak(former_top, task,
-                                          std::memory_order::seq_cst,
-                                          std::memory_order::relaxed));
-
-  if (former_top == no_execution_underway) {
+  task->next_ = nullptr;
+  Push(task, task);
+}
+
+void Strand::SubmitBatch(wheels::IntrusiveList<Task>& tasks, SchedulerHint) {
+  Task* first = tasks.PopFront();
+  if (first == nullptr) {
+    return;
+  }
+
+  // chained privately, published by the exchange in Push
+  Node* last = first;
+  while (Task* task = tasks.PopFront()) {
+    last->next_ = task;
+    last = task;
+  }
+  last->next_ = nullptr;
+
+  Push(first, last);
+}
+
+void Strand::Push(Node* first, Node* last) {
+  // seq_cst because it can be an external submit to ThreadPool
+  // which manipulates with TaskFlags thus must be cross_var hb
+  Node* prev = head_.exchange(last, std::memory_order::seq_cst);
+
+  if (prev == nullptr) {
+    // strand was idle: Run left tail_ at the detached stub
+    StoreNext(&stub_, first);
     underlying_.Submit(this);
+  } else {
+    // Run waits for this link if it gets to prev first
+    StoreNext(prev, first);
   }
-  // failure never implies access to anything-> relaxed
-  // push needs to be in hb with PopAll so rel here and acq in PopAll
 }
 
 // is only called by one thread
-// is only called when top_ != fake_node_
 void Strand::Run() noexcept {
-  // save resourse state
-  auto preserved_stack = stack_;
+  RunFrame frame{this, nullptr};
+  RunFrameGuard guard{frame};
+
+  // Tasks pushed after that one wait for the next Run,
+  // so that the strand does not occupy the thread
+  Node* const last = head_.load(std::memory_order::acquire);
+  bool batch_done = false;
+
+  const Budget budget = budget_;
+  const bool limited = !budget.IsUnlimited();
+  const auto start = limited ? std::chrono::steady_clock::now()
+                             : std::chrono::steady_clock::time_point{};
+  size_t tasks_done = 0;
+
+  while (true) {
+    if (IsEmpty()) {
+      LogBatch(tasks_done);
+
+      if (!TryGoIdle()) {
+        // a producer is halfway through Push
+        underlying_.Submit(this);
+      }
+      return;
+    }
+
+    if (batch_done) {
+      LogBatch(tasks_done);
+
+      // Always an internal submit
+      underlying_.Submit(this);
+      return;
+    }
 
-  // steal stack
-  Node* stolen_queue_head =
-      preserved_stack->exchange(execution_underway, std::memory_order::acquire);
-  // reading fullptr never let's into critical section so no need for rel here
+    if (limited && tasks_done > 0) {
+      const bool out_of_tasks =
+          budget.max_tasks != 0 && tasks_done >= budget.max_tasks;
+      const bool out_of_time =
+          budget.max_time.count() != 0 &&
+          std::chrono::steady_clock::now() - start >= budget.max_time;
+
+      if (out_of_tasks || out_of_time) {
+        LogBatch(tasks_done);
+        shard_->Increment(StrandMetric::BudgetExhausted, 1);
+
+        // head_ stays non-null, submitters won't schedule us
+        underlying_.Submit(this, SchedulerHint::Last);
+        return;
+      }
+    }
+
+    Node* task = Pop();
+    task->next_ = nullptr;
 
-  {  // reverse stack
-    while (stolen_queue_head->next_ != execution_underway &&
-           stolen_queue_head->next_ != no_execution_underway) {
-      stolen_queue_head->next_->prev_ = stolen_queue_head;
+    task->AsItem()->Run();
 
-      stolen_queue_head = stolen_queue_head->next_;
+    if (frame.destroyed) {
+      return;
     }
+
+    ++tasks_done;
+
+    // `last` is the stub if the previous Run has pushed it
+    batch_done = task == last || (last == &stub_ && tail_ == &stub_);
   }
+}
 
-  // do some tasks
+bool Strand::IsEmpty() {
+  return tail_ == &stub_ && LoadNext(&stub_) == nullptr;
+}
 
-  while (stolen_queue_head != nullptr) {
-    Node* task = stolen_queue_head;
+// Never returns a node producers may still link to:
+// the last node is returned only after the stub is pushed behind it
+Strand::Node* Strand::Pop() {
+  Node* tail = tail_;
+  Node* next = LoadNext(tail);
 
-    stolen_queue_head = stolen_queue_head->prev_;
-    task->prev_ = task->next_ = nullptr;
+  if (tail == &stub_) {
+    tail_ = tail = next;
+    next = LoadNext(tail);
+  }
 
-    task->AsItem()->Run();
+  if (next == nullptr) {
+    if (tail == head_.load(std::memory_order::acquire)) {
+      stub_.next_ = nullptr;
+      Push(&stub_, &stub_);
+    }
+
+    // either the stub or a producer which is halfway through Push
+    while ((next = LoadNext(tail)) == nullptr) {
+      twist::ed::CpuRelax();
+    }
   }
 
-  Node* execution_copy = execution_underway;
-  // Always an internal submit thus can be kept at release
-  if (!preserved_stack->compare_exchange_strong(
-          execution_copy, no_execution_underway, std::memory_order::release,
-          std::memory_order::relaxed)) {
-    underlying_.Submit(this);
+  tail_ = next;
+  return tail;
+}
+
+bool Strand::TryGoIdle() {
+  Node* expected = &stub_;
+  // release: next Run starts with our tail_
+  return head_.compare_exchange_strong(expected, nullptr,
+                                       std::memory_order::release,
+                                       std::memory_order::relaxed);
+}
+
+void Strand::LogBatch(size_t tasks) {
+  if (tasks == 0) {
+    return;
+  }
+
+  shard_->Increment(StrandMetric::Activations, 1);
+
+  if (tasks == 1) {
+    shard_->Increment(StrandMetric::BatchesOf1, 1);
+  } else if (tasks < 16) {
+    shard_->Increment(StrandMetric::BatchesOf2To15, 1);
+  } else if (tasks < 128) {
+    shard_->Increment(StrandMetric::BatchesOf16To127, 1);
+  } else {
+    shard_->Increment(StrandMetric::BatchesOf128Plus, 1);
   }
-  // reading nullptr submits another Run call which needs to be in hb with this
-  // one
 }
 
 }  // namespace weave::executors
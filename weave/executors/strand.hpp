@@ -2,14 +2,59 @@
 
 #include <weave/executors/executor.hpp>
 
+#include <weave/satellite/logger.hpp>
+
 #include <twist/ed/stdlike/atomic.hpp>
 #include <wheels/intrusive/list.hpp>
 
-#include <memory>
+#include <array>
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
 
 namespace weave::executors {
 
+//////////////////////////////////////////////////////////////////////
+
+#if defined(__WEAVE_METRICS__)
+inline const bool kCollectStrandMetrics = true;
+#else
+inline const bool kCollectStrandMetrics = false;
+#endif
+
+// Compile-time ids of kStrandMetrics
+enum class StrandMetric : size_t {
+  Activations,
+  BatchesOf1,
+  BatchesOf2To15,
+  BatchesOf16To127,
+  BatchesOf128Plus,
+  BudgetExhausted,
+  Count
+};
+
+// Indexed by StrandMetric
+inline constexpr std::array<std::string_view,
+                            static_cast<size_t>(StrandMetric::Count)>
+    kStrandMetricNames{"Strand activations",     "Strand batches of 1",
+                       "Strand batches of 2-15", "Strand batches of 16-127",
+                       "Strand batches of 128+", "Strand budget exhausted"};
+
+static_assert(!kStrandMetricNames.back().empty(),
+              "Every StrandMetric needs a name");
+
+inline const std::vector<std::string> kStrandMetrics(
+    kStrandMetricNames.begin(), kStrandMetricNames.end());
+
+//////////////////////////////////////////////////////////////////////
+
 // Strand / serial executor / asynchronous mutex
+//
+// Tasks are kept in an intrusive MPSC queue (Vyukov):
+// submit is a single exchange, Run drains in FIFO order
+// May be destroyed by its last task or by anyone once
+// all of its tasks have completed
 
 class Strand : public IExecutor,
                public Task {
@@ -17,8 +62,26 @@ class Strand : public IExecutor,
   using Node = wheels::IntrusiveListNode<Task>;
   using AtomicPtr = twist::ed::stdlike::atomic<Node*>;
 
+  using Logger = satellite::Logger<kCollectStrandMetrics, true>;
+
+  // Limits a single Run, after that the strand yields
+  // to the underlying executor with SchedulerHint::Last
+  struct Budget {
+    // 0 means no limit
+    size_t max_tasks = 0;
+    std::chrono::microseconds max_time{0};
+
+    bool IsUnlimited() const {
+      return max_tasks == 0 && max_time.count() == 0;
+    }
+  };
+
   explicit Strand(IExecutor& underlying);
 
+  Strand(IExecutor& underlying, Budget budget);
+
+  ~Strand();
+
   // Non-copyable
   Strand(const Strand&) = delete;
   Strand& operator=(const Strand&) = delete;
@@ -30,17 +93,39 @@ class Strand : public IExecutor,
   // IExecutor
   void Submit(Task*, SchedulerHint) override;
 
+  // Whole batch is pushed with a single exchange
+  void SubmitBatch(wheels::IntrusiveList<Task>&, SchedulerHint) override;
+
+  Logger::Metrics Metrics() {
+    return logger_.GatherMetrics();
+  }
+
  private:
   void Run() noexcept override;
 
+  // Links [first, last] after the current head
+  void Push(Node* first, Node* last);
+
+  // Consumer only
+  bool IsEmpty();
+  Node* Pop();
+  bool TryGoIdle();
+
+  void LogBatch(size_t tasks);
+
  private:
   IExecutor& underlying_;
+  const Budget budget_;
+
+  // Last pushed node, nullptr when no Run is scheduled
+  alignas(64) AtomicPtr head_{nullptr};
 
-  std::shared_ptr<AtomicPtr> stack_;
+  // Oldest node, touched by Run only
+  alignas(64) Node* tail_{&stub_};
+  Node stub_;
 
-  static inline Node* no_execution_underway{nullptr};
-  static inline Node* execution_underway{
-      reinterpret_cast<Node*>(std::numeric_limits<uintptr_t>::max())};
+  Logger logger_;
+  Logger::LoggerShard* shard_;
 };
 
 }  // namespace weave::executors
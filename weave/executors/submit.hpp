@@ -3,13 +3,79 @@
 #include <weave/executors/executor.hpp>
 #include <weave/executors/task.hpp>
 
-#include <weave/futures/make/just.hpp>
-#include <weave/futures/combine/seq/via.hpp>
-#include <weave/futures/combine/seq/map.hpp>
-#include <weave/futures/run/detach.hpp>
+#include <weave/executors/detail/task_pool.hpp>
+
+#include <weave/cancel/never.hpp>
+
+#include <weave/satellite/meta_data.hpp>
+#include <weave/satellite/satellite.hpp>
+
+#include <new>
+#include <utility>
 
 namespace weave::executors {
 
+namespace detail {
+
+// Fire-and-forget task with the function stored inline
+// Memory comes from TaskPool, no futures machinery involved
+// Base is Task or derives from it, KeyedStrand keeps the key there
+
+template <typename F, typename Base = Task>
+class SubmitTask final : public Base {
+  static constexpr bool Pooled() {
+    return sizeof(SubmitTask) <= TaskPool::kMaxBlockSize;
+  }
+
+ public:
+  // `base_args` go to the Base constructor
+  template <typename... BaseArgs>
+  static SubmitTask* Make(IExecutor& exe, F fun, BaseArgs&&... base_args) {
+    void* memory = Pooled() ? TaskPool::Allocate(sizeof(SubmitTask))
+                           : ::operator new(sizeof(SubmitTask));
+
+    return new (memory) SubmitTask(exe, std::move(fun),
+                                   std::forward<BaseArgs>(base_args)...);
+  }
+
+  void Run() noexcept override {
+    {
+      // same context as Via would set up
+      satellite::MetaData old = satellite::SetContext(exe_, cancel::Never());
+
+      fun_();
+
+      satellite::RestoreContext(std::move(old));
+    }
+
+    Destroy();
+  }
+
+ private:
+  template <typename... BaseArgs>
+  SubmitTask(IExecutor& exe, F fun, BaseArgs&&... base_args)
+      : Base(std::forward<BaseArgs>(base_args)...),
+        exe_(&exe),
+        fun_(std::move(fun)) {
+  }
+
+  void Destroy() {
+    this->~SubmitTask();
+
+    if constexpr (Pooled()) {
+      TaskPool::Release(this, sizeof(SubmitTask));
+    } else {
+      ::operator delete(this);
+    }
+  }
+
+ private:
+  IExecutor* exe_;
+  F fun_;
+};
+
+}  // namespace detail
+
 /*
  * Usage:
  *
@@ -22,8 +88,7 @@ namespace weave::executors {
 template <typename F>
 void Submit(IExecutor& exe, F fun,
             SchedulerHint hint = SchedulerHint::UpToYou) {
-  futures::Just() | futures::Via(exe, hint) | futures::Map(std::move(fun)) |
-      futures::Detach();
+  exe.Submit(detail::SubmitTask<F>::Make(exe, std::move(fun)), hint);
 }
 
-}  // namespace weave::executors
\ No newline at end of file
+}  // namespace weave::executors
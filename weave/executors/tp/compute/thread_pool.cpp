@@ -1,42 +1,88 @@
 #include <weave/executors/tp/compute/thread_pool.hpp>
 
+#include <weave/support/fast_rand.hpp>
+
 #include <twist/ed/local/ptr.hpp>
+#include <twist/ed/local/val.hpp>
 
 #include <wheels/core/panic.hpp>
 
+#include <chrono>
+
 namespace weave::executors::tp::compute {
 
 static twist::ed::ThreadLocalPtr<ThreadPool> pool;
 
-ThreadPool::ThreadPool(size_t num_threads)
-    : num_threads_(num_threads) {
+// Index of the current worker in its pool
+static twist::ed::ThreadLocal<size_t> worker_index{0};
+
+// Spreads external submits over shards
+static twist::ed::ThreadLocal<support::FastRand> submit_rand{
+    support::FastRand{static_cast<uint64_t>(
+        std::chrono::high_resolution_clock::now().time_since_epoch().count())}};
+
+ThreadPool::ThreadPool(size_t num_threads, QueueMode mode)
+    : num_threads_(num_threads),
+      mode_(mode),
+      sharded_tasks_(mode == QueueMode::PerWorker ? num_threads : 1) {
 }
 
 void ThreadPool::Start() {
   for (size_t i = 0; i < num_threads_; i++) {
-    workers_.emplace_back([this]() {
-      Worker();
+    workers_.emplace_back([this, i]() {
+      Worker(i);
     });
   }
 }
 
-void ThreadPool::Worker() noexcept {
+void ThreadPool::Worker(size_t index) noexcept {
   pool = this;
+  *worker_index = index;
 
-  while (Task* next = tasks_.Take()) {
+  while (Task* next = Take(index)) {
     next->Run();
 
     incomplete_tasks_.Done();
   }
 }
 
+Task* ThreadPool::Take(size_t index) {
+  if (mode_ == QueueMode::PerWorker) {
+    return sharded_tasks_.Take(index);
+  }
+  return tasks_.Take();
+}
+
+size_t ThreadPool::SubmitShard() {
+  if (Current() == this) {
+    return *worker_index;
+  }
+  return (*submit_rand)() % num_threads_;
+}
+
 ThreadPool::~ThreadPool() {
   assert(workers_.empty());
 }
 
 void ThreadPool::Submit(Task* task, SchedulerHint) {
   incomplete_tasks_.Add(1);
-  tasks_.Put(task);
+
+  if (mode_ == QueueMode::PerWorker) {
+    sharded_tasks_.Put(task, SubmitShard());
+  } else {
+    tasks_.Put(task);
+  }
+}
+
+void ThreadPool::SubmitBatch(wheels::IntrusiveList<Task>& tasks,
+                             SchedulerHint) {
+  incomplete_tasks_.Add(tasks.Size());
+
+  if (mode_ == QueueMode::PerWorker) {
+    sharded_tasks_.PutMany(tasks, SubmitShard());
+  } else {
+    tasks_.PutMany(tasks);
+  }
 }
 
 ThreadPool* ThreadPool::Current() {
@@ -49,6 +95,7 @@ void ThreadPool::WaitIdle() {
 
 void ThreadPool::Stop() {
   tasks_.Close();
+  sharded_tasks_.Close();
 
   for (auto& thread : workers_) {
     thread.join();
@@ -2,6 +2,7 @@
 
 #include <weave/executors/executor.hpp>
 
+#include <weave/threads/blocking/sharded_blocking_queue.hpp>
 #include <weave/threads/blocking/unbounded_blocking_queue.hpp>
 
 #include <weave/threads/blocking/wait_group.hpp>
@@ -13,12 +14,20 @@
 
 namespace weave::executors::tp::compute {
 
+enum class QueueMode {
+  // One queue behind a mutex, fine for a few threads
+  Shared,
+  // A queue shard per worker, workers take from others when theirs is empty,
+  // Submit wakes a worker only if one is going to sleep
+  PerWorker,
+};
+
 // Thread pool for independent CPU-bound tasks
-// Fixed pool of worker threads + shared unbounded blocking queue
+// Fixed pool of worker threads + unbounded blocking queue, see QueueMode
 
 class ThreadPool : public IExecutor {
  public:
-  explicit ThreadPool(size_t threads);
+  explicit ThreadPool(size_t threads, QueueMode mode = QueueMode::Shared);
   ~ThreadPool();
 
   // Non-copyable
@@ -34,6 +43,8 @@ class ThreadPool : public IExecutor {
   // IExecutor
   void Submit(Task*, SchedulerHint) override;
 
+  void SubmitBatch(wheels::IntrusiveList<Task>&, SchedulerHint) override;
+
   static ThreadPool* Current();
 
   void WaitIdle();
@@ -41,13 +52,23 @@ class ThreadPool : public IExecutor {
   void Stop();
 
  private:
-  void Worker() noexcept;
+  void Worker(size_t index) noexcept;
+
+  Task* Take(size_t index);
+
+  // Shard for a task submitted by the current thread
+  size_t SubmitShard();
 
  private:
   // runtime core part: task queue, thread vector, threads number
   const size_t num_threads_;
+  const QueueMode mode_;
   std::vector<twist::ed::stdlike::thread> workers_;
+
+  // QueueMode::Shared
   threads::blocking::UnboundedBlockingQueue<Task> tasks_;
+  // QueueMode::PerWorker
+  threads::blocking::ShardedBlockingQueue<Task> sharded_tasks_;
 
   // WaitIdle
   threads::blocking::WaitGroup incomplete_tasks_;
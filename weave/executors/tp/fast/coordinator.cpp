@@ -42,13 +42,13 @@ bool Coordinator::TryStartSpinning() {
                 "TryStartSpinning: you can't be a non-worker!");
 
   uint64_t curr = state_.load();
-  const size_t max_threads = caller->host_.threads_;
+  const size_t max_threads = caller->host_.ActiveWorkers();
 
   while (true) {
     auto [idle, spinning] = View(curr);
 
     if (2 * spinning > max_threads) {
-      caller->logger_shard_->Increment("Times denied by coordinator", 1);
+      caller->logger_shard_->Increment(Metric::DeniedByCoordinator, 1);
 
       return false;
     }
@@ -75,14 +75,20 @@ bool Coordinator::StopSpinning() {
   return spinning == 1;
 }
 
-void Coordinator::TryParkMe(uint32_t old_wakeups) {
+void Coordinator::TryParkMe(uint32_t old_wakeups,
+                            std::optional<timers::Millis> timeout) {
   auto caller = Worker::Current();
   WHEELS_VERIFY(caller != nullptr, "TryParkMe: you can't be a non-worker!");
 
-  caller->logger_shard_->Increment("Syscal parkings", 1);
+  caller->logger_shard_->Increment(Metric::SyscallParkings, 1);
 
-  twist::ed::futex::Wait(caller->wakeups_, old_wakeups,
-                         std::memory_order::relaxed);
+  if (timeout) {
+    twist::ed::futex::WaitTimed(caller->wakeups_, old_wakeups,
+                                std::max(timers::Millis(1), *timeout));
+  } else {
+    twist::ed::futex::Wait(caller->wakeups_, old_wakeups,
+                           std::memory_order::relaxed);
+  }
 
   CancelPark();
 }
@@ -99,6 +105,30 @@ bool Coordinator::TryWakeWorker() {
   return true;
 }
 
+size_t Coordinator::TryWakeWorkers(size_t count) {
+  auto [idle, spinning] = View(state_.load());
+
+  if (idle == 0 || spinning >= count) {
+    return 0;
+  }
+
+  const size_t to_wake = std::min<size_t>(idle, count - spinning);
+  size_t woken = 0;
+
+  while (woken < to_wake) {
+    Worker* sleeper = sleepers_.TryDequeue();
+    if (sleeper == nullptr) {
+      break;
+    }
+
+    if (sleeper->TryWake()) {
+      ++woken;
+    }
+  }
+
+  return woken;
+}
+
 uint32_t Coordinator::AnnouncePark() {
   Worker* caller = Worker::Current();
   WHEELS_ASSERT(caller != nullptr, "AnnouncePark: you can't be a non-worker!");
@@ -128,4 +158,11 @@ bool Coordinator::ShouldWake() {
   return idle > 0 && spinning == 0;
 }
 
+bool Coordinator::AllBusy() {
+  uint64_t observed = state_.load();
+  auto [idle, spinning] = View(observed);
+
+  return idle == 0 && spinning == 0;
+}
+
 }  // namespace weave::executors::tp::fast
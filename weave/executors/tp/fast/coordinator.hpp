@@ -2,7 +2,12 @@
 
 #include <twist/ed/stdlike/atomic.hpp>
 
+#include <optional>
+
 #include <weave/executors/tp/fast/queues/parking_lot.hpp>
+
+#include <weave/timers/millis.hpp>
+
 #include <weave/threads/blocking/spinlock.hpp>
 #include <weave/threads/blocking/stdlike/mutex.hpp>
 
@@ -24,13 +29,21 @@ class Coordinator {
 
   void CancelPark();
 
-  void TryParkMe(uint32_t);
+  // Parks until woken up or until timeout expires
+  void TryParkMe(uint32_t, std::optional<timers::Millis> timeout = std::nullopt);
 
   bool ShouldWake();
 
+  // Nobody is parked or spinning
+  bool AllBusy();
+
   // true if no need for further backoff
   bool TryWakeWorker();
 
+  // Wakes up to `count` parked workers, spinning ones count as awake
+  // Returns number of workers woken up
+  size_t TryWakeWorkers(size_t count);
+
  private:
   twist::ed::stdlike::atomic<uint64_t> state_{0};
   ParkingLot<Worker> sleepers_;
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <chrono>
+#include <cstdlib>
+
+namespace weave::executors::tp::fast {
+
+// Elastic pool keeps between `min_threads` and `threads` workers running:
+// workers parked for `idle_timeout` retire, retired ones are spawned again
+// once every running worker is busy and queues keep growing
+
+struct Elasticity {
+  size_t min_threads{1};
+
+  std::chrono::milliseconds idle_timeout{1000};
+};
+
+}  // namespace weave::executors::tp::fast
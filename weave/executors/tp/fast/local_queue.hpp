@@ -0,0 +1,36 @@
+#pragma once
+
+#include <weave/executors/tp/fast/queues/work_stealing_queue.hpp>
+#include <weave/executors/tp/fast/queues/growable_work_stealing_queue.hpp>
+
+#include <cstdlib>
+
+namespace weave::executors::tp::fast {
+
+// Initial capacity for the growable one
+#if !defined(TWIST_FAULTY)
+inline constexpr size_t kLocalQueueCapacity = 256;
+#else
+inline constexpr size_t kLocalQueueCapacity = 17;
+#endif
+
+// Local queue policies of a worker:
+//  Bounded: fixed ring, overflow goes to the global queue
+//  Growable: Chase–Lev deque which doubles instead of overflowing
+
+class BoundedLocalQueue : public WorkStealingQueue<kLocalQueueCapacity> {};
+
+class GrowableLocalQueue : public GrowableWorkStealingQueue {
+ public:
+  GrowableLocalQueue()
+      : GrowableWorkStealingQueue(kLocalQueueCapacity) {
+  }
+};
+
+#if defined(__WEAVE_GROWABLE_LQ__)
+using DefaultLocalQueue = GrowableLocalQueue;
+#else
+using DefaultLocalQueue = BoundedLocalQueue;
+#endif
+
+}  // namespace weave::executors::tp::fast
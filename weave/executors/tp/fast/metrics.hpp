@@ -2,6 +2,13 @@
 
 #include <weave/satellite/logger.hpp>
 
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
 namespace weave::executors::tp::fast {
 
 #if defined(__WEAVE_METRICS__)
@@ -10,24 +17,93 @@ inline const bool kCollectMetrics = true;
 inline const bool kCollectMetrics = false;
 #endif
 
-#if defined(__WEAVE_REALTIME__)
-inline const bool kAtomicMetrics = true;
+#if defined(__WEAVE_LATENCY_TRACING__)
+inline const bool kTraceLatency = true;
 #else
-inline const bool kAtomicMetrics = false;
+inline const bool kTraceLatency = false;
 #endif
 
-inline const std::vector<std::string> kMetrics{"Launched from lifo",
-                                               "Launched from local queue",
-                                               "Launched from global queue",
-                                               "Discarded lifo_slots",
-                                               "Overflows in local queue",
-                                               "Syscal parkings",
-                                               "Steal attempts",
-                                               "Times denied by coordinator",
-                                               "Stolen from local queue"};
+// Compile-time ids for LoggerShard::Increment,
+// the hot path never looks names up
+enum class Metric : size_t {
+  LaunchedFromLifo,
+  LaunchedFromLocalQueue,
+  LaunchedFromGlobalQueue,
+  DiscardedLifoSlots,
+  LocalQueueOverflows,
+  SyscallParkings,
+  FoundWhileSpinning,
+  StealAttempts,
+  StealProbes,
+  EmptyStealProbes,
+  StolenFromLastVictim,
+  DeniedByCoordinator,
+  StolenFromLocalQueue,
+  StolenFromSameNode,
+  StolenFromRemoteNode,
+  GrabbedFromRemoteNode,
+  WorkersSpawned,
+  WorkersRetired,
+  Count
+};
+
+// Indexed by Metric
+inline constexpr std::array<std::string_view,
+                            static_cast<size_t>(Metric::Count)>
+    kMetricNames{"Launched from lifo",
+                 "Launched from local queue",
+                 "Launched from global queue",
+                 "Discarded lifo_slots",
+                 "Overflows in local queue",
+                 "Syscal parkings",
+                 "Found while spinning",
+                 "Steal attempts",
+                 "Steal probes",
+                 "Empty steal probes",
+                 "Stolen from last victim",
+                 "Times denied by coordinator",
+                 "Stolen from local queue",
+                 "Stolen from same node",
+                 "Stolen from remote node",
+                 "Grabbed from remote node",
+                 "Workers spawned",
+                 "Workers retired"};
+
+static_assert(!kMetricNames.back().empty(), "Every Metric needs a name");
+
+inline const std::vector<std::string> kMetrics(kMetricNames.begin(),
+                                               kMetricNames.end());
+
+// Nanoseconds from Submit to Run, by where the worker picked the task
+enum class Latency : size_t {
+  FromLifo,
+  FromLocalQueue,
+  FromGlobalQueue,
+  Stolen,
+  Count
+};
+
+// Indexed by Latency
+inline constexpr std::array<std::string_view,
+                            static_cast<size_t>(Latency::Count)>
+    kLatencyNames{"Latency from lifo", "Latency from local queue",
+                  "Latency from global queue", "Latency of stolen"};
+
+static_assert(!kLatencyNames.back().empty(), "Every Latency needs a name");
+
+inline const std::vector<std::string> kLatencyHistograms(
+    kLatencyNames.begin(), kLatencyNames.end());
+
+// Enqueue timestamps, see TaskFlags::Stamp
+inline uint64_t TraceClockNow() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
 
 //////////////////////////////////////////////////////////////////////////////////////////
 
-using Logger = satellite::Logger<kCollectMetrics, kAtomicMetrics>;
+// Every worker writes to its own shard
+using Logger = satellite::Logger<kCollectMetrics, false>;
 
 }  // namespace weave::executors::tp::fast
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <twist/ed/wait/spin.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+
+namespace weave::executors::tp::fast {
+
+// How long idle workers keep looking for work
+// before they fall asleep on a futex
+
+struct ParkingPolicy {
+  // Extra steal rounds before parking, 0 means park right away
+  size_t max_spin_rounds = 0;
+
+  // Adaptive budget never goes below that
+  size_t min_spin_rounds = 0;
+
+  // Number of pauses between rounds, doubles every round
+  size_t min_backoff = 1;
+  size_t max_backoff = 64;
+
+  // Tune the budget of every worker to its recent park/wake history
+  bool adaptive = true;
+
+  // Being woken up sooner than that means spinning would have paid off
+  std::chrono::microseconds short_park{50};
+
+  // Old behaviour: park after a single failed steal round
+  static ParkingPolicy ParkRightAway() {
+    return {};
+  }
+
+  // For loads that come in bursts
+  static ParkingPolicy Bursty() {
+    return {.max_spin_rounds = 64,
+            .min_spin_rounds = 0,
+            .min_backoff = 4,
+            .max_backoff = 256,
+            .adaptive = true};
+  }
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Exponential pause-based backoff
+
+class Backoff {
+ public:
+  explicit Backoff(const ParkingPolicy& policy)
+      : pauses_(std::max<size_t>(policy.min_backoff, 1)),
+        max_pauses_(std::max(policy.max_backoff, pauses_)) {
+  }
+
+  void operator()() {
+    for (size_t i = 0; i < pauses_; ++i) {
+      twist::ed::CpuRelax();
+    }
+
+    pauses_ = std::min(pauses_ * 2, max_pauses_);
+  }
+
+ private:
+  size_t pauses_;
+  const size_t max_pauses_;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Spin budget of a single worker
+// Moving average of the number of rounds which would have been enough
+
+class SpinBudget {
+  // fixed point
+  static const size_t kScale = 8;
+
+ public:
+  void Reset(const ParkingPolicy& policy) {
+    average_ = policy.max_spin_rounds / 2 * kScale;
+  }
+
+  size_t Rounds(const ParkingPolicy& policy) const {
+    if (!policy.adaptive) {
+      return policy.max_spin_rounds;
+    }
+
+    return std::clamp(average_ / kScale, policy.min_spin_rounds,
+                      std::max(policy.min_spin_rounds, policy.max_spin_rounds));
+  }
+
+  // Work showed up after `round` extra rounds
+  void Hit(size_t round) {
+    Update(2 * round);
+  }
+
+  // Spent the whole budget and parked for `slept`
+  void Parked(std::chrono::nanoseconds slept, const ParkingPolicy& policy) {
+    if (slept < policy.short_park) {
+      // a bit more spinning would have saved the syscall
+      Update(2 * Rounds(policy) + 1);
+    } else {
+      Update(0);
+    }
+  }
+
+ private:
+  void Update(size_t target_rounds) {
+    average_ = average_ - average_ / kScale + target_rounds;
+  }
+
+ private:
+  size_t average_{0};
+};
+
+}  // namespace weave::executors::tp::fast
@@ -5,21 +5,31 @@
 #include <weave/threads/blocking/stdlike/mutex.hpp>
 #include <weave/threads/blocking/spinlock.hpp>
 
+#include <twist/ed/stdlike/atomic.hpp>
 #include <twist/ed/stdlike/mutex.hpp>
+#include <twist/ed/stdlike/thread.hpp>
 
 #include <wheels/intrusive/list.hpp>
 
+#include <array>
+#include <functional>
 #include <span>
 
 namespace weave::executors::tp::fast {
 
 class GlobalQueueBlockingImpl;
 
+class GlobalQueueShardedImpl;
+
 class GlobalQueueLockfreeImpl;  // ConcurrentQueue is not seq_cst
                                 // also cringe and fake + L + ratio
 
 // Unbounded queue shared between workers
+#if defined(__WEAVE_SHARDED_GQ__)
+using GlobalQueue = GlobalQueueShardedImpl;
+#else
 using GlobalQueue = GlobalQueueBlockingImpl;
+#endif
 
 // Check different mutexes
 class GlobalQueueBlockingImpl {
@@ -39,10 +49,16 @@ class GlobalQueueBlockingImpl {
       overflow_l.PushBack(node);
     }
 
+    Append(overflow_l);
+  }
+
+  void Append(wheels::IntrusiveList<Task>& tasks) {
+    const size_t count = tasks.Size();
+
     threads::blocking::stdlike::LockGuard lock(mutex_);
 
-    tasks_.Append(overflow_l);
-    size_ += overflow.size();
+    tasks_.Append(tasks);
+    size_ += count;
   }
 
   // Returns nullptr if queue is empty
@@ -78,4 +94,162 @@ class GlobalQueueBlockingImpl {
   size_t size_{0};
 };
 
+//////////////////////////////////////////////////////////////////////
+
+// Spreads producers over independently locked shards
+// FIFO is kept per shard only
+class GlobalQueueShardedImpl {
+  static const size_t kShards = 8;
+
+  struct alignas(64) Shard {
+    wheels::IntrusiveList<Task> tasks{};
+    threads::blocking::SpinLock mutex;
+    // hint for consumers, written under the mutex
+    twist::ed::stdlike::atomic<size_t> size{0};
+  };
+
+ public:
+  void Push(Task* item) {
+    Shard& shard = shards_[HomeShard()];
+
+    {
+      threads::blocking::stdlike::LockGuard lock(shard.mutex);
+
+      shard.tasks.PushBack(item);
+      Resize(shard, 1);
+
+      // before unlock: a consumer may take the task right after it,
+      // its fetch_sub must not get ahead of us
+      // seq_cst: pairs with the parking protocol
+      size_.fetch_add(1);
+    }
+  }
+
+  void Append(std::span<Task*> overflow) {
+    // prepare a list to merge
+    wheels::IntrusiveList<Task> overflow_l;
+
+    for (auto node : overflow) {
+      overflow_l.PushBack(node);
+    }
+
+    Append(overflow_l);
+  }
+
+  void Append(wheels::IntrusiveList<Task>& tasks) {
+    const size_t count = tasks.Size();
+
+    Shard& shard = shards_[HomeShard()];
+
+    {
+      threads::blocking::stdlike::LockGuard lock(shard.mutex);
+
+      shard.tasks.Append(tasks);
+      Resize(shard, count);
+
+      // see Push
+      size_.fetch_add(count);
+    }
+  }
+
+  // Returns nullptr if queue is empty
+  Task* TryPop() {
+    if (size_.load() == 0) {
+      return nullptr;
+    }
+
+    Task* task = nullptr;
+
+    ForEachShard([&](Shard& shard) {
+      threads::blocking::stdlike::LockGuard lock(shard.mutex);
+
+      if ((task = shard.tasks.PopFront()) != nullptr) {
+        Resize(shard, -1);
+      }
+
+      return task != nullptr;
+    });
+
+    if (task != nullptr) {
+      size_.fetch_sub(1);
+    }
+
+    return task;
+  }
+
+  // Returns number of items in `out_buffer`
+  size_t Grab(std::span<Task*> out_buffer, size_t workers) {
+    const size_t size = size_.load();
+
+    if (size == 0) {
+      return 0;
+    }
+
+    size_t num_to_grab = std::min(
+        size < workers && size != 0 ? 1 : size / workers, out_buffer.size());
+
+    size_t num_grabbed = 0;
+
+    ForEachShard([&](Shard& shard) {
+      threads::blocking::stdlike::LockGuard lock(shard.mutex);
+
+      size_t taken = 0;
+      while (num_grabbed < num_to_grab) {
+        Task* task = shard.tasks.PopFront();
+        if (task == nullptr) {
+          break;
+        }
+
+        out_buffer[num_grabbed++] = task;
+        taken++;
+      }
+
+      Resize(shard, -(int64_t)taken);
+
+      return num_grabbed == num_to_grab;
+    });
+
+    size_.fetch_sub(num_grabbed);
+
+    return num_grabbed;
+  }
+
+ private:
+  // Producers (and consumers) start from their own shard
+  static size_t HomeShard() {
+    using ThreadId = twist::ed::stdlike::thread::id;
+
+    return std::hash<ThreadId>{}(twist::ed::stdlike::this_thread::get_id()) %
+           kShards;
+  }
+
+  // Visits non-empty shards until `visitor` returns true
+  template <typename Visitor>
+  void ForEachShard(Visitor visitor) {
+    const size_t home = HomeShard();
+
+    for (size_t i = 0; i < kShards; ++i) {
+      Shard& shard = shards_[(home + i) % kShards];
+
+      if (shard.size.load(std::memory_order::acquire) == 0) {
+        continue;
+      }
+
+      if (visitor(shard)) {
+        return;
+      }
+    }
+  }
+
+  // Under shard mutex
+  static void Resize(Shard& shard, int64_t delta) {
+    shard.size.store(shard.size.load(std::memory_order::relaxed) + delta,
+                     std::memory_order::release);
+  }
+
+ private:
+  std::array<Shard, kShards> shards_{};
+  twist::ed::stdlike::atomic<size_t> size_{0};
+};
+
 }  // namespace weave::executors::tp::fast
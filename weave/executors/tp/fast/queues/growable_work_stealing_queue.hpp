@@ -0,0 +1,227 @@
+#pragma once
+
+#include <weave/executors/task.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace weave::executors::tp::fast {
+
+// Chase–Lev style deque which grows instead of overflowing
+//
+// Single producer (owner) pushes at the tail, everyone including the owner
+// takes from the head, so tasks keep the FIFO order of WorkStealingQueue.
+// When the buffer is full the owner copies live tasks into a buffer twice
+// as large and publishes it. Consumers may still be reading the old one,
+// so retired buffers are kept until the queue dies: capacities double,
+// thus they never take more memory than the current buffer
+
+class GrowableWorkStealingQueue {
+  class Buffer {
+   public:
+    // capacity is a power of two
+    explicit Buffer(size_t capacity)
+        : mask_(capacity - 1),
+          slots_(std::make_unique<twist::ed::stdlike::atomic<Task*>[]>(
+              capacity)) {
+    }
+
+    size_t Capacity() const {
+      return mask_ + 1;
+    }
+
+    twist::ed::stdlike::atomic<Task*>& At(size_t index) {
+      return slots_[index & mask_];
+    }
+
+   private:
+    const size_t mask_;
+    std::unique_ptr<twist::ed::stdlike::atomic<Task*>[]> slots_;
+  };
+
+ public:
+  explicit GrowableWorkStealingQueue(size_t capacity)
+      : buffer_(new Buffer(std::bit_ceil(std::max<size_t>(capacity, 2)))) {
+  }
+
+  ~GrowableWorkStealingQueue() {
+    delete buffer_.load(std::memory_order::relaxed);
+  }
+
+  // Non-copyable
+  GrowableWorkStealingQueue(const GrowableWorkStealingQueue&) = delete;
+  GrowableWorkStealingQueue& operator=(const GrowableWorkStealingQueue&) =
+      delete;
+
+  // Never fails
+  bool TryPush(Task* item) {
+    size_t cached_tail = tail_.load(std::memory_order::relaxed);
+    Buffer* buffer = Reserve(cached_tail, 1);
+
+    buffer->At(cached_tail).store(item, std::memory_order::relaxed);
+
+    // make item visible to everyone
+    tail_.store(cached_tail + 1, std::memory_order::release);
+
+    return true;
+  }
+
+  void PushMany(std::span<Task*> items) {
+    if (items.empty()) {
+      return;
+    }
+
+    size_t cached_tail = tail_.load(std::memory_order::relaxed);
+    Buffer* buffer = Reserve(cached_tail, items.size());
+
+    for (size_t i = 0; i < items.size(); ++i) {
+      buffer->At(cached_tail + i).store(items[i], std::memory_order::relaxed);
+    }
+
+    tail_.store(cached_tail + items.size(), std::memory_order::release);
+  }
+
+  // Moves all of `tasks`, returns their number
+  size_t PushSome(wheels::IntrusiveList<Task>& tasks) {
+    const size_t count = tasks.Size();
+    if (count == 0) {
+      return 0;
+    }
+
+    size_t cached_tail = tail_.load(std::memory_order::relaxed);
+    Buffer* buffer = Reserve(cached_tail, count);
+
+    for (size_t i = 0; i < count; ++i) {
+      buffer->At(cached_tail + i).store(tasks.PopFront(),
+                                        std::memory_order::relaxed);
+    }
+
+    tail_.store(cached_tail + count, std::memory_order::release);
+
+    return count;
+  }
+
+  // Owner only, returns nullptr if queue is empty
+  Task* TryPop() {
+    // owner is the only writer of tail_ and buffer_
+    size_t cached_tail = tail_.load(std::memory_order::relaxed);
+    size_t cached_head = head_.load(std::memory_order::relaxed);
+    Buffer* buffer = buffer_.load(std::memory_order::relaxed);
+
+    Task* ret_val;
+
+    do {
+      if (cached_tail == cached_head) {
+        return nullptr;
+      }
+      ret_val = buffer->At(cached_head).load(std::memory_order::relaxed);
+    } while (!head_.compare_exchange_weak(cached_head, cached_head + 1,
+                                          std::memory_order::relaxed));
+
+    return ret_val;
+  }
+
+  // For stealing, grabs up to half of the tasks
+  // Returns number of tasks in `out_buffer`
+  size_t Grab(std::span<Task*> out_buffer) {
+    if (out_buffer.empty()) {
+      return 0;
+    }
+
+    size_t num_grabbed;
+
+    size_t cached_head = head_.load(std::memory_order::relaxed);
+    size_t cached_tail;
+
+    do {
+      // tail before buffer: a tail published after a resize
+      // comes with the new buffer
+      cached_tail = tail_.load(std::memory_order::acquire);
+      Buffer* buffer = buffer_.load(std::memory_order::acquire);
+
+      if (cached_tail - cached_head == 0) {
+        return 0;
+      }
+
+      const size_t threshold =
+          std::max<size_t>((cached_tail - cached_head) / 2, 1);
+      num_grabbed = std::min(out_buffer.size(), threshold);
+
+      // both buffers hold [cached_head, cached_tail) if head is still valid,
+      // otherwise the CAS below fails
+      for (size_t i = 0; i < num_grabbed; ++i) {
+        out_buffer[i] =
+            buffer->At(cached_head + i).load(std::memory_order::relaxed);
+      }
+
+    } while (!head_.compare_exchange_weak(
+        cached_head, cached_head + num_grabbed, std::memory_order::release,
+        std::memory_order::relaxed));
+
+    return num_grabbed;
+  }
+
+  size_t SizeEstimate() {
+    size_t head_estimate = head_.load(std::memory_order::relaxed);
+    size_t tail_estimate = tail_.load(std::memory_order::relaxed);
+    return tail_estimate - head_estimate;
+  }
+
+  // Owner only
+  size_t Capacity() {
+    return buffer_.load(std::memory_order::relaxed)->Capacity();
+  }
+
+ private:
+  // Buffer with room for `count` more tasks after tail
+  Buffer* Reserve(size_t cached_tail, size_t count) {
+    Buffer* buffer = buffer_.load(std::memory_order::relaxed);
+
+    // slots below head may still be read by a consumer which lost the race
+    size_t cached_head = head_.load(std::memory_order::acquire);
+
+    if (cached_tail - cached_head + count <= buffer->Capacity()) {
+      return buffer;
+    }
+
+    return Grow(buffer, cached_head, cached_tail, count);
+  }
+
+  Buffer* Grow(Buffer* buffer, size_t cached_head, size_t cached_tail,
+               size_t count) {
+    const size_t needed = cached_tail - cached_head + count;
+    auto* bigger = new Buffer(
+        std::bit_ceil(std::max(needed, 2 * buffer->Capacity())));
+
+    // indices stay the same, only the mask changes
+    for (size_t i = cached_head; i != cached_tail; ++i) {
+      bigger->At(i).store(buffer->At(i).load(std::memory_order::relaxed),
+                          std::memory_order::relaxed);
+    }
+
+    // published before the next tail_ store
+    buffer_.store(bigger, std::memory_order::release);
+
+    retired_.emplace_back(buffer);
+
+    return bigger;
+  }
+
+ private:
+  twist::ed::stdlike::atomic<size_t> head_{0};
+  twist::ed::stdlike::atomic<size_t> tail_{0};
+
+  twist::ed::stdlike::atomic<Buffer*> buffer_;
+
+  // Owner only
+  std::vector<std::unique_ptr<Buffer>> retired_;
+};
+
+}  // namespace weave::executors::tp::fast
@@ -4,6 +4,8 @@
 
 #include <twist/ed/stdlike/atomic.hpp>
 
+#include <wheels/intrusive/list.hpp>
+
 #include <array>
 #include <span>
 
@@ -58,6 +60,37 @@ class WorkStealingQueue {
     }
   }
 
+  // Moves tasks from the front of `tasks` while there is room
+  // Publishes all of them with a single store
+  // Returns number of pushed tasks
+  size_t PushSome(wheels::IntrusiveList<Task>& tasks) {
+    size_t cached_head = head_.load(std::memory_order::acquire);
+    size_t cached_tail =
+        tail_.load(std::memory_order::relaxed);  // sync done via PO
+
+    const size_t free_slots = Capacity - (cached_tail - cached_head);
+
+    size_t num_pushed = 0;
+
+    while (num_pushed < free_slots) {
+      Task* task = tasks.PopFront();
+      if (task == nullptr) {
+        break;
+      }
+
+      buffer_[MakeValid(cached_tail + num_pushed)].item_.store(
+          task, std::memory_order::relaxed);
+      ++num_pushed;
+    }
+
+    if (num_pushed > 0) {
+      // make all new tasks visible to everyone
+      tail_.store(cached_tail + num_pushed, std::memory_order::release);
+    }
+
+    return num_pushed;
+  }
+
   // Returns nullptr if queue is empty
   Task* TryPop() {
     // This function can be called only by the thread which is allowed to call
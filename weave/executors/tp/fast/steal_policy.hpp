@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstdlib>
+
+namespace weave::executors::tp::fast {
+
+// How an idle worker picks the victim to steal from
+// Parked workers are never probed, their queues are empty anyway
+
+enum class StealPolicy {
+  // Sweep over all victims in random order, same node first
+  Random,
+
+  // Sample kStealChoices victims and probe the most loaded one,
+  // the last successful victim is probed first
+  LoadAware,
+};
+
+// Power of two choices
+inline const size_t kStealChoices = 2;
+
+}  // namespace weave::executors::tp::fast
@@ -18,6 +18,15 @@ struct TaskFlags {
   static void Reset(uintptr_t& target, Flags flag) {
     target ^= flag;
   }
+
+  // Latency tracing keeps the enqueue time above the flag bits
+  static void Stamp(uintptr_t& target, uint64_t now) {
+    target = (now << 1) | (target & External);
+  }
+
+  static uint64_t Timestamp(uintptr_t target) {
+    return target >> 1;
+  }
 };
 
 }  // namespace weave::executors::tp::fast
\ No newline at end of file
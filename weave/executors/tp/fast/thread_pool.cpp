@@ -3,22 +3,75 @@
 #include <weave/executors/tp/fast/thread_pool.hpp>
 #include <weave/executors/tp/fast/thread_runner.hpp>
 
+#include <wheels/core/assert.hpp>
+
+#if !defined(TWIST_FIBERS) && LINUX
+#include <sched.h>
+#endif
+
 namespace weave::executors::tp::fast {
 
 ThreadPool::ThreadPool(const size_t threads)
+    : ThreadPool(threads, Topology::Flat()) {
+}
+
+ThreadPool::ThreadPool(const size_t threads, Topology topology)
     : threads_(threads),
       runner_(&runners::ThreadRunner::Instance()),
-      logger_(kMetrics, threads) {
-  // create workers
+      logger_(kMetrics, threads, kLatencyHistograms) {
+  WHEELS_VERIFY(topology.NumNodes() != 0, "Topology without nodes!");
+
+  // fold nodes which would be left without workers into the others
+  while (topology.NumNodes() > threads) {
+    auto extra = std::move(topology.nodes.back());
+    topology.nodes.pop_back();
+
+    auto& target = topology.nodes[topology.NumNodes() % threads];
+    target.insert(target.end(), extra.begin(), extra.end());
+  }
+
+  const size_t nodes = topology.NumNodes();
+
+  node_workers_.resize(nodes, 0);
 
   for (size_t i = 0; i < threads; ++i) {
-    workers_.emplace_back(*this, i, logger_.MakeShard(i));
+    // contiguous blocks of workers per node
+    worker_nodes_.push_back(i * nodes / threads);
+    node_workers_[worker_nodes_.back()]++;
+  }
+
+  for (size_t node = 0; node < nodes; ++node) {
+    global_tasks_.emplace_back();
+
+    for (int cpu : topology.nodes[node]) {
+      if (cpu_nodes_.size() <= (size_t)cpu) {
+        cpu_nodes_.resize(cpu + 1, 0);
+      }
+      cpu_nodes_[cpu] = node;
+    }
+  }
+
+  // create workers
+
+  for (size_t i = 0, position = 0; i < threads; ++i, ++position) {
+    const size_t node = worker_nodes_[i];
+
+    if (i != 0 && node != worker_nodes_[i - 1]) {
+      position = 0;
+    }
+
+    const auto& cpus = topology.nodes[node];
+    const int cpu = cpus.empty() ? -1 : cpus[position % cpus.size()];
+
+    workers_.emplace_back(*this, i, node, cpu, logger_.MakeShard(i));
   }
 }
 
 void ThreadPool::Start() {
   work_count_.Add(1);
 
+  active_workers_.store(threads_, std::memory_order::relaxed);
+
   for (auto& worker : workers_) {
     worker.Start();
   }
@@ -29,6 +82,10 @@ ThreadPool::~ThreadPool() {
 }
 
 void ThreadPool::Submit(Task* task, SchedulerHint hint) {
+  if constexpr (kTraceLatency) {
+    TaskFlags::Stamp(task->flags, TraceClockNow());
+  }
+
   // load source of the submit call
   Worker* sender = Worker::Current();
 
@@ -37,7 +94,7 @@ void ThreadPool::Submit(Task* task, SchedulerHint hint) {
     TaskFlags::SetBits(task->flags, TaskFlags::External);
 
     work_count_.StealthAdd(1);
-    global_tasks_.Push(task);
+    NodeQueue(CurrentNode()).Push(task);
 
     TryWakeWorkers();
 
@@ -51,11 +108,110 @@ void ThreadPool::Submit(Task* task, SchedulerHint hint) {
   TryWakeWorkers();
 }
 
+void ThreadPool::SubmitBatch(wheels::IntrusiveList<Task>& tasks,
+                             SchedulerHint hint) {
+  const size_t count = tasks.Size();
+
+  if (count == 0) {
+    return;
+  }
+
+  if constexpr (kTraceLatency) {
+    const uint64_t now = TraceClockNow();
+
+    for (Task& task : tasks) {
+      TaskFlags::Stamp(task.flags, now);
+    }
+  }
+
+  // load source of the submit call
+  Worker* sender = Worker::Current();
+
+  // sender is from the outside of this scheduler
+  if (sender == nullptr || &(sender->Host()) != this) {
+    for (Task& task : tasks) {
+      TaskFlags::SetBits(task.flags, TaskFlags::External);
+    }
+
+    work_count_.StealthAdd(count);
+    NodeQueue(CurrentNode()).Append(tasks);
+
+    TryWakeWorkers(count);
+
+    return;
+  }
+
+  // sender is an actual worker
+  sender->PushBatch(tasks, hint);
+
+  TryWakeWorkers(count);
+}
+
+void ThreadPool::SetParkingPolicy(ParkingPolicy policy) {
+  parking_policy_ = policy;
+
+  for (auto& worker : workers_) {
+    worker.spin_budget_.Reset(parking_policy_);
+  }
+}
+
+void ThreadPool::SetElasticity(Elasticity elasticity) {
+  WHEELS_VERIFY(elasticity.min_threads >= 1 &&
+                    elasticity.min_threads <= threads_,
+                "min_threads must be in [1, threads]");
+
+  elasticity_ = elasticity;
+}
+
+void ThreadPool::TryGrow() {
+  if (!membership_mutex_.TryLock()) {
+    // somebody else is resizing the pool
+    return;
+  }
+
+  if (!stopped_.load(std::memory_order::relaxed) &&
+      ActiveWorkers() < threads_) {
+    for (auto& worker : workers_) {
+      if (worker.retired_) {
+        // retired thread is about to exit if it has not yet
+        worker.thread_->join();
+
+        active_workers_.fetch_add(1, std::memory_order::relaxed);
+        worker.logger_shard_->Increment(Metric::WorkersSpawned, 1);
+        worker.Start();
+
+        break;
+      }
+    }
+  }
+
+  membership_mutex_.Unlock();
+}
+
+bool ThreadPool::TryRetire(Worker& worker) {
+  threads::blocking::stdlike::LockGuard lock(membership_mutex_);
+
+  if (stopped_.load(std::memory_order::relaxed) ||
+      ActiveWorkers() <= elasticity_->min_threads) {
+    return false;
+  }
+
+  active_workers_.fetch_sub(1, std::memory_order::relaxed);
+  worker.retired_ = true;
+
+  return true;
+}
+
 void ThreadPool::Stop() {
-  // declare that the work is over
-  stopped_.store(true,
-                 std::memory_order::relaxed);  // we sync on thread::join
-                                               // anyway so just relaxed
+  {
+    // no retirements or respawns from now on
+    threads::blocking::stdlike::LockGuard lock(membership_mutex_);
+
+    // declare that the work is over
+    stopped_.store(true,
+                   std::memory_order::relaxed);  // we sync on thread::join
+                                                 // anyway so just relaxed
+  }
 
   // join workers
   for (auto& worker : workers_) {
@@ -64,12 +220,31 @@ void ThreadPool::Stop() {
 
   // clear workers_
   workers_.clear();
+
+  // nobody will poll them anymore
+  timers_.Clear();
 }
 
 Logger::Metrics ThreadPool::Metrics() {
   return logger_.GatherMetrics();
 }
 
+size_t ThreadPool::CurrentNode() const {
+  if (NumNodes() == 1) {
+    return 0;
+  }
+
+#if !defined(TWIST_FIBERS) && LINUX
+  int cpu = sched_getcpu();
+
+  if (cpu >= 0 && (size_t)cpu < cpu_nodes_.size()) {
+    return cpu_nodes_[cpu];
+  }
+#endif
+
+  return 0;
+}
+
 ThreadPool* ThreadPool::Current() {
   auto* worker = Worker::Current();
   return worker == nullptr ? nullptr : &worker->Host();
@@ -5,8 +5,13 @@
 #include <weave/executors/tp/fast/queues/global_queue.hpp>
 #include <weave/executors/tp/fast/worker.hpp>
 #include <weave/executors/tp/fast/coordinator.hpp>
+#include <weave/executors/tp/fast/elasticity.hpp>
 #include <weave/executors/tp/fast/metrics.hpp>
+#include <weave/executors/tp/fast/parking_policy.hpp>
 #include <weave/executors/tp/fast/runner.hpp>
+#include <weave/executors/tp/fast/steal_policy.hpp>
+#include <weave/executors/tp/fast/timer_processor.hpp>
+#include <weave/executors/tp/fast/topology.hpp>
 
 #include <weave/threads/blocking/work_count.hpp>
 
@@ -14,6 +19,7 @@
 #include <twist/ed/stdlike/random.hpp>
 
 #include <deque>
+#include <optional>
 
 namespace weave::executors::tp::fast {
 
@@ -22,9 +28,14 @@ namespace weave::executors::tp::fast {
 class ThreadPool : public IExecutor {
   friend class Worker;
   friend class Coordinator;
+  friend class TimerProcessor;
 
  public:
   explicit ThreadPool(const size_t threads);
+
+  // Groups workers by NUMA node: pins them to the node's cpus,
+  // gives every node its own global queue and steals within the node first
+  ThreadPool(const size_t threads, Topology topology);
   ~ThreadPool();
 
   // Non-copyable
@@ -36,6 +47,9 @@ class ThreadPool : public IExecutor {
   // IExecutor
   void Submit(Task*, SchedulerHint) override;
 
+  // One queue operation and at most one wakeup per task
+  void SubmitBatch(wheels::IntrusiveList<Task>&, SchedulerHint) override;
+
   void WaitIdle() {
     work_count_.Done(1);
     work_count_.Wait();
@@ -44,22 +58,45 @@ class ThreadPool : public IExecutor {
 
   void Stop();
 
-  // After Stop
+  // Lock-free, can be called while the pool is running
   Logger::Metrics Metrics();
 
+  // WEAVE_LATENCY_TRACING, any time
+  auto LatencyHistograms() {
+    return logger_.GatherHistograms();
+  }
+
   static ThreadPool* Current();
 
+  // Timers processed by workers, no extra thread involved
+  // Timers left after Stop are fired right away
+  TimerProcessor& Timers() {
+    return timers_;
+  }
+
   void SetRunner(IRunner& runner) {
     runner_ = &runner;
   }
 
-  Logger* GetLogger() {
-#if !defined(__WEAVE_REALTIME__)
-    WHEELS_PANIC(
-        "Real-time Logging is not supported. Please turn flag "
-        "WEAVE_REALTIME_METRICS on.");
-#endif
+  // Call before Start
+  void SetParkingPolicy(ParkingPolicy policy);
+
+  // Call before Start
+  void SetStealPolicy(StealPolicy policy) {
+    steal_policy_ = policy;
+  }
+
+  // Lets the pool shrink down to `min_threads` when idle,
+  // `threads` from the constructor is the upper bound
+  // Call before Start
+  void SetElasticity(Elasticity elasticity);
+
+  // Workers which are not retired
+  size_t ActiveWorkers() const {
+    return active_workers_.load(std::memory_order::relaxed);
+  }
 
+  Logger* GetLogger() {
     return &logger_;
   }
 
@@ -69,15 +106,55 @@ class ThreadPool : public IExecutor {
   // b) ParkingLot is empty
   // c) Some worker starts spinning
   void TryWakeWorkers() {
+    Backoff backoff{parking_policy_};
+
     while (bool keep_trying = !coordinator_.TryWakeWorker()) {
-      ;  // Backoff
+      backoff();
+    }
+
+    MaybeGrow();
+  }
+
+  // wakes workers in proportion to the number of new tasks,
+  // falls back to the single wakeup protocol if nobody was woken up
+  void TryWakeWorkers(size_t tasks) {
+    const size_t wanted = std::min(tasks, threads_);
+
+    if (wanted == 1 || coordinator_.TryWakeWorkers(wanted) == 0) {
+      TryWakeWorkers();
+    } else {
+      MaybeGrow();
+    }
+  }
+
+  // Spawns a retired worker if there is nobody left to wake up
+  void MaybeGrow() {
+    if (elasticity_ && ActiveWorkers() < threads_ &&
+        coordinator_.AllBusy()) {
+      TryGrow();
     }
   }
 
+  void TryGrow();
+
+  // Called by an idle worker, false if it has to stay
+  bool TryRetire(Worker& worker);
+
   IRunner& Runner() {
     return *runner_;
   }
 
+  size_t NumNodes() const {
+    return global_tasks_.size();
+  }
+
+  GlobalQueue& NodeQueue(size_t node) {
+    return global_tasks_[node];
+  }
+
+  // Node of the cpu we are running on (used for external submits)
+  size_t CurrentNode() const;
+
  private:
   // used for constexpr kind of thing
   const size_t threads_;
@@ -86,15 +163,30 @@ class ThreadPool : public IExecutor {
   IRunner* runner_;
 
   Coordinator coordinator_;
+  ParkingPolicy parking_policy_{};
+  StealPolicy steal_policy_{StealPolicy::Random};
+
+  // One global queue per NUMA node
+  std::deque<GlobalQueue> global_tasks_{};
 
-  GlobalQueue global_tasks_;
+  std::vector<size_t> worker_nodes_{};  // node of each worker
+  std::vector<size_t> node_workers_{};  // number of workers on each node
+  std::vector<size_t> cpu_nodes_{};     // node of each cpu
 
   twist::ed::stdlike::random_device random_;
 
   twist::ed::stdlike::atomic<bool> stopped_{false};
 
+  // Elastic sizing
+  std::optional<Elasticity> elasticity_{};
+  twist::ed::stdlike::atomic<size_t> active_workers_{0};
+  // guards worker retirement, respawn and Stop
+  threads::blocking::SpinLock membership_mutex_;
+
   threads::blocking::WorkCount work_count_;
 
+  TimerProcessor timers_{*this};
+
   Logger logger_;
 };
 
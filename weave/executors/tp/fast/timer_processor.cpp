@@ -0,0 +1,130 @@
+#include <weave/executors/tp/fast/timer_processor.hpp>
+#include <weave/executors/tp/fast/thread_pool.hpp>
+#include <weave/executors/tp/fast/worker.hpp>
+
+#include <limits>
+
+namespace weave::executors::tp::fast {
+
+using namespace std::chrono_literals;
+
+void TimerProcessor::AddTimer(timers::TimerBase* timer) {
+  pending_.fetch_add(1, std::memory_order::relaxed);
+
+  // timer may fire and be destroyed by another worker right after Push
+  const int64_t deadline = queue_.Push(timer).time_since_epoch().count();
+
+  // Pairs with TryBecomeTimekeeper
+  int64_t wake_at = wake_at_.load();
+
+  if (wake_at == 0) {
+    // nobody sleeps on timers: either workers are busy
+    // and will poll the timer or they are parked
+    host_.TryWakeWorkers();
+  } else if (deadline < wake_at) {
+    WakeTimekeeper();
+  }
+}
+
+void TimerProcessor::NotifyProcessor(timers::TimerBase* timer) {
+  queue_.PostCancelRequest(timer);
+
+  // cancelled timers should fire right away
+  if (wake_at_.load() != 0) {
+    WakeTimekeeper();
+  }
+}
+
+bool TimerProcessor::Poll() {
+  if (pending_.load(std::memory_order::relaxed) == 0) {
+    return false;
+  }
+
+  if (!mutex_.TryLock()) {
+    // somebody else is polling
+    return false;
+  }
+
+  auto timers = queue_.GrabReadyTimers().first;
+
+  mutex_.Unlock();
+
+  return RunTimers(std::move(timers)) != 0;
+}
+
+std::optional<timers::Millis> TimerProcessor::TryBecomeTimekeeper(
+    Worker* self) {
+  // AddTimer wakes parked workers if there is no timekeeper
+  if (pending_.load(std::memory_order::relaxed) == 0 && !queue_.HasPending()) {
+    return std::nullopt;
+  }
+
+  Worker* expected = nullptr;
+  if (!timekeeper_.compare_exchange_strong(expected, self)) {
+    return std::nullopt;
+  }
+
+  std::optional<timers::Millis> until_next;
+
+  {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+    until_next = queue_.UntilNextDeadline();
+  }
+
+  if (until_next && *until_next == 0ms) {
+    RetireTimekeeper(self);
+    return 0ms;
+  }
+
+  int64_t wake_at = until_next
+                        ? (Clock::now() + *until_next).time_since_epoch().count()
+                        : std::numeric_limits<int64_t>::max();
+
+  wake_at_.store(wake_at);
+
+  // Timers added before the store above might have missed the timekeeper
+  if (queue_.HasPending()) {
+    RetireTimekeeper(self);
+    return 0ms;
+  }
+
+  return until_next;
+}
+
+void TimerProcessor::RetireTimekeeper(Worker* self) {
+  if (timekeeper_.load() != self) {
+    return;
+  }
+
+  // before giving up the role so that the next timekeeper
+  // can't be overwritten
+  wake_at_.store(0);
+  timekeeper_.store(nullptr);
+}
+
+void TimerProcessor::Clear() {
+  RunTimers(queue_.TakeAll());
+}
+
+void TimerProcessor::WakeTimekeeper() {
+  if (Worker* timekeeper = timekeeper_.load()) {
+    timekeeper_wakeups_.fetch_add(1, std::memory_order::relaxed);
+    timekeeper->Wake();
+  }
+}
+
+size_t TimerProcessor::RunTimers(
+    wheels::IntrusiveList<timers::TimerBase> timers) {
+  size_t count = 0;
+
+  while (timers.NonEmpty()) {
+    timers.PopFront()->Run();
+    count++;
+  }
+
+  pending_.fetch_sub(count, std::memory_order::relaxed);
+
+  return count;
+}
+
+}  // namespace weave::executors::tp::fast
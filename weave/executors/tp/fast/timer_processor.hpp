@@ -0,0 +1,85 @@
+#pragma once
+
+#include <weave/timers/processor.hpp>
+#include <weave/timers/processors/detail/timing_wheel.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <optional>
+
+namespace weave::executors::tp::fast {
+
+class ThreadPool;
+class Worker;
+
+// Timers are processed by the workers of the pool itself:
+// expired timers are run right from the scheduling loop
+// and one parked worker (timekeeper) sleeps until the nearest deadline.
+// Timer callbacks run on workers and must not block.
+
+class TimerProcessor : public timers::IProcessor {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  explicit TimerProcessor(ThreadPool& host)
+      : host_(host) {
+  }
+
+  // IProcessor
+  void AddTimer(timers::TimerBase*) override;
+
+  void NotifyProcessor(timers::TimerBase*) override;
+
+  // Runs expired timers unless some other worker is doing it already
+  // true if some timers were run
+  bool Poll();
+
+  // Before parking
+  // Returns park timeout if caller became a timekeeper,
+  // zero timeout means that timers must be polled instead of parking
+  // nullopt means "park until woken up"
+  std::optional<timers::Millis> TryBecomeTimekeeper(Worker* self);
+
+  // After waking up
+  void RetireTimekeeper(Worker* self);
+
+  // Fires everything that's left, workers must be joined
+  void Clear();
+
+  // Some timers were added but not run yet
+  bool HasPending() const {
+    return pending_.load(std::memory_order::relaxed) != 0;
+  }
+
+  // Cross-thread wakeups of a sleeping timekeeper, for tests
+  size_t TimekeeperWakeups() const {
+    return timekeeper_wakeups_.load(std::memory_order::relaxed);
+  }
+
+ private:
+  void WakeTimekeeper();
+
+  // Returns number of timers run
+  size_t RunTimers(wheels::IntrusiveList<timers::TimerBase> timers);
+
+ private:
+  ThreadPool& host_;
+
+  // Wheel consumer
+  threads::blocking::SpinLock mutex_;
+  timers::detail::TimingWheel queue_;
+
+  // Timers which were added but not run yet
+  twist::ed::stdlike::atomic<size_t> pending_{0};
+
+  twist::ed::stdlike::atomic<Worker*> timekeeper_{nullptr};
+  // When timekeeper is going to wake up (ns since clock epoch),
+  // zero if nobody sleeps on timers
+  twist::ed::stdlike::atomic<int64_t> wake_at_{0};
+
+  twist::ed::stdlike::atomic<size_t> timekeeper_wakeups_{0};
+};
+
+}  // namespace weave::executors::tp::fast
@@ -0,0 +1,91 @@
+#include <weave/executors/tp/fast/topology.hpp>
+
+#include <charconv>
+#include <fstream>
+#include <string>
+
+namespace weave::executors::tp::fast {
+
+Topology Topology::Detect() {
+  Topology topology;
+
+  for (size_t node = 0;; ++node) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) +
+                       "/cpulist");
+
+    if (!file.is_open()) {
+      break;
+    }
+
+    std::string list;
+    std::getline(file, list);
+
+    auto cpus = ParseCpuList(list);
+
+    // memory-only nodes have no cpus to run workers on
+    if (!cpus.empty()) {
+      topology.nodes.push_back(std::move(cpus));
+    }
+  }
+
+  if (topology.nodes.empty()) {
+    return Flat();
+  }
+
+  return topology;
+}
+
+Topology Topology::Flat() {
+  return Topology{{{}}};
+}
+
+std::vector<int> Topology::ParseCpuList(std::string_view list) {
+  std::vector<int> cpus;
+
+  auto parse = [](std::string_view token, int& out) {
+    auto [ptr, ec] =
+        std::from_chars(token.data(), token.data() + token.size(), out);
+    return ec == std::errc{} && ptr == token.data() + token.size();
+  };
+
+  while (!list.empty()) {
+    size_t comma = list.find(',');
+    auto range = list.substr(0, comma);
+    list = comma == std::string_view::npos ? std::string_view{}
+                                           : list.substr(comma + 1);
+
+    // trailing newline or spaces
+    while (!range.empty() && (range.back() == '\n' || range.back() == ' ')) {
+      range.remove_suffix(1);
+    }
+
+    if (range.empty()) {
+      continue;
+    }
+
+    size_t dash = range.find('-');
+
+    int first = 0;
+    int last = 0;
+
+    if (dash == std::string_view::npos) {
+      if (!parse(range, first)) {
+        return {};
+      }
+      last = first;
+    } else {
+      if (!parse(range.substr(0, dash), first) ||
+          !parse(range.substr(dash + 1), last) || last < first) {
+        return {};
+      }
+    }
+
+    for (int cpu = first; cpu <= last; ++cpu) {
+      cpus.push_back(cpu);
+    }
+  }
+
+  return cpus;
+}
+
+}  // namespace weave::executors::tp::fast
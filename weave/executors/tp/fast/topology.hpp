@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdlib>
+#include <string_view>
+#include <vector>
+
+namespace weave::executors::tp::fast {
+
+// NUMA layout used to group workers
+
+struct Topology {
+  // cpus of each node, empty list means "do not pin"
+  std::vector<std::vector<int>> nodes;
+
+  size_t NumNodes() const {
+    return nodes.size();
+  }
+
+  // Reads /sys/devices/system/node/node*/cpulist
+  // Falls back to Flat() if nothing could be read
+  static Topology Detect();
+
+  // Single node, no pinning: behaves like a plain pool
+  static Topology Flat();
+
+  // Parses lists like "0-3,8-11"
+  static std::vector<int> ParseCpuList(std::string_view list);
+};
+
+}  // namespace weave::executors::tp::fast
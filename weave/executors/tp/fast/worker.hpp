@@ -3,9 +3,10 @@
 #include <weave/executors/task.hpp>
 #include <weave/executors/hint.hpp>
 
-#include <weave/executors/tp/fast/queues/work_stealing_queue.hpp>
+#include <weave/executors/tp/fast/local_queue.hpp>
 #include <weave/executors/tp/fast/coordinator.hpp>
 #include <weave/executors/tp/fast/metrics.hpp>
+#include <weave/executors/tp/fast/parking_policy.hpp>
 #include <weave/executors/tp/fast/picker.hpp>
 #include <weave/executors/tp/fast/task_flags.hpp>
 
@@ -14,7 +15,9 @@
 
 #include <wheels/intrusive/list.hpp>
 
+#include <chrono>
 #include <cstdlib>
+#include <limits>
 #include <optional>
 #include <random>
 #include <span>
@@ -23,27 +26,27 @@ namespace weave::executors::tp::fast {
 
 inline const size_t kVyukovGQueue = 61;
 
+inline const size_t kTimersPollPeriod = 31;
+
 class ThreadPool;
 
 ///////////////////////////////////////////////////////////////////
 
+// Local queue policy is picked at build time, see DefaultLocalQueue
+
 class Worker : public wheels::IntrusiveListNode<Worker>,
                private IPicker {
   friend class Coordinator;
   friend class ThreadPool;
 
  private:
-#if !defined(TWIST_FAULTY)
-  static const size_t kLocalQueueCapacity = 256;
-#else
-  static const size_t kLocalQueueCapacity = 17;
-#endif
-
   static const size_t kMaxLifoStreak =
       std::min(kVyukovGQueue, kLocalQueueCapacity) / 2;
 
  public:
-  Worker(ThreadPool& host, size_t index, Logger::LoggerShard*);
+  // cpu < 0 means "do not pin"
+  Worker(ThreadPool& host, size_t index, size_t node, int cpu,
+         Logger::LoggerShard*);
 
   void Start();
 
@@ -52,6 +55,9 @@ class Worker : public wheels::IntrusiveListNode<Worker>,
   // Single producer
   void Push(Task*, SchedulerHint);
 
+  // Single producer, leaves `tasks` empty
+  void PushBatch(wheels::IntrusiveList<Task>& tasks, SchedulerHint);
+
   // Steal from this worker
   size_t StealTasks(std::span<Task*> out_buffer);
 
@@ -66,6 +72,11 @@ class Worker : public wheels::IntrusiveListNode<Worker>,
     return host_;
   }
 
+  // Racy, exact only for the owner
+  size_t LocalQueueSize() {
+    return local_tasks_.SizeEstimate();
+  }
+
   // debugging
   size_t Index() {
     return index_;
@@ -77,10 +88,14 @@ class Worker : public wheels::IntrusiveListNode<Worker>,
   // Use in Push
   void PushToLifoSlot(Task* task);
   void PushToLocalQueue(Task* task);
+  void PushBatchToLocalQueue(wheels::IntrusiveList<Task>& tasks);
 
   // Use in PushToLocalQueue
   void OffloadTasksToGlobalQueue(std::span<Task*>, size_t);
 
+  // Own node queue first, then remote ones
+  size_t GrabTasksFromGlobalQueues(std::span<Task*> out_buffer);
+
   // Use in TryPickTask
   Task* TryGrabTasksFromGlobalQueue();
   Task* TryPickTaskFromLifoSlot();
@@ -91,21 +106,46 @@ class Worker : public wheels::IntrusiveListNode<Worker>,
   // Use in TryStealTasks
   Task* TryStealTaskIter();
 
+  // Use in TryStealTaskIter, return number of tasks in `buffer`
+  size_t StealRandom(std::span<Task*> buffer);
+  size_t StealLoadAware(std::span<Task*> buffer);
+
+  // Best of kStealChoices random victims from indices_[begin, end)
+  size_t SampleAndSteal(size_t begin, size_t end, std::span<Task*> buffer);
+
+  // Skips parked victims
+  size_t TryStealFrom(size_t victim, std::span<Task*> buffer);
+
+  // Steal rounds with backoff while the spin budget lasts
+  Task* SpinForTask();
+
   // Use in PickTask
   Task* TryPickTask();
   Task* TryPickTaskBeforePark();
 
+  // Enqueue-to-run latency of a task picked from `source`
+  void TraceLatency(Task* task, Latency source);
+
   // Or park thread
   Task* PickTask() override;
   bool StopRequested() const override;
 
+  // Elastic pool: retire after being idle for too long
+  bool ShouldRetire(uint32_t old_wakeups, std::chrono::nanoseconds slept);
+
   // Run Loop
   void Work();
 
+  void PinToCpu();
+
  private:
   ThreadPool& host_;
   const size_t index_;
 
+  // NUMA placement
+  const size_t node_;
+  const int cpu_;
+
   // Worker thread
   std::optional<twist::ed::stdlike::thread> thread_;
 
@@ -114,14 +154,27 @@ class Worker : public wheels::IntrusiveListNode<Worker>,
   size_t lifo_streak_ = 0;
 
   // Local queue
-  WorkStealingQueue<kLocalQueueCapacity> local_tasks_;
+  DefaultLocalQueue local_tasks_;
 
   // LIFO slot
   twist::ed::stdlike::atomic<Task*> lifo_slot_{nullptr};
 
   // random generationc
   std::mt19937_64 twister_;
+
+  // same node victims come first
   std::vector<int> indices_;
+  size_t same_node_victims_{0};
+
+  // LoadAware stealing: index of the last successful victim
+  static const size_t kNoVictim = std::numeric_limits<size_t>::max();
+  size_t last_victim_{kNoVictim};
+
+  // Adaptive spinning before parking
+  SpinBudget spin_budget_{};
+
+  // Elastic pool: thread has exited or is about to
+  bool retired_{false};
 
   // Parking lot & other coordination
   twist::ed::stdlike::atomic<uint32_t> wakeups_{0};
@@ -6,9 +6,15 @@
 
 #include <wheels/core/panic.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
+#if !defined(TWIST_FIBERS) && LINUX
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace weave::executors::tp::fast {
 
 ///////////////////////////////////////////////////////////////////
@@ -17,13 +23,25 @@ TWISTED_THREAD_LOCAL_PTR(Worker, worker);
 
 ///////////////////////////////////////////////////////////////////
 
-Worker::Worker(ThreadPool& host, size_t index, Logger::LoggerShard* shard)
+Worker::Worker(ThreadPool& host, size_t index, size_t node, int cpu,
+               Logger::LoggerShard* shard)
     : host_(host),
       index_(index),
+      node_(node),
+      cpu_(cpu),
       twister_(host_.random_()),
       indices_(host_.threads_ - 1),
       logger_shard_(shard) {
   std::iota(indices_.begin(), indices_.end(), 1);
+
+  // victims from our own node go first
+  auto remote = std::stable_partition(
+      indices_.begin(), indices_.end(), [this](int offset) {
+        return host_.worker_nodes_[(index_ + offset) % host_.threads_] ==
+               node_;
+      });
+
+  same_node_victims_ = remote - indices_.begin();
 }
 
 Worker* Worker::Current() {
@@ -31,6 +49,8 @@ Worker* Worker::Current() {
 }
 
 void Worker::Start() {
+  retired_ = false;
+
   host_.work_count_.StealthAdd(1);
 
   thread_.emplace([this]() {
@@ -39,9 +59,12 @@ void Worker::Start() {
 }
 
 void Worker::Join() {
-  Wake();
+  // retired worker gave up its share of work_count_ itself
+  if (!retired_) {
+    Wake();
 
-  host_.work_count_.StealthDone(1);
+    host_.work_count_.StealthDone(1);
+  }
 
   thread_->join();
 }
@@ -49,9 +72,26 @@ void Worker::Join() {
 void Worker::Work() {
   worker = this;
 
+  PinToCpu();
+
   host_.Runner().RunnerRoutine(*this);
 }
 
+void Worker::PinToCpu() {
+  if (cpu_ < 0) {
+    return;
+  }
+
+#if !defined(TWIST_FIBERS) && LINUX
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu_, &set);
+
+  // best effort: cpu may be outside of our cgroup/cpuset
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#endif
+}
+
 // Park/Wake right here
 
 bool Worker::TryWake() {
@@ -1,29 +1,43 @@
 #include <weave/executors/tp/fast/worker.hpp>
 #include <weave/executors/tp/fast/thread_pool.hpp>
 
+#include <chrono>
+
 namespace weave::executors::tp::fast {
 
 bool Worker::StopRequested() const {
-  return host_.stopped_.load(std::memory_order::relaxed);
+  return retired_ || host_.stopped_.load(std::memory_order::relaxed);
 }
 
 // big loop
 Task* Worker::PickTask() {
+  if (retired_) {
+    return nullptr;
+  }
+
   iter_++;
 
+  // expired timers are run right here
+  if (iter_ % kTimersPollPeriod == 0) {
+    host_.timers_.Poll();
+  }
+
   // global-lifo-local
   if (Task* task = TryPickTask()) {
     return task;
   }
 
   while (!StopRequested()) {
+    // timers can push tasks into our local queue
+    if (host_.timers_.Poll()) {
+      if (Task* task = TryPickTask()) {
+        return task;
+      }
+    }
+
     // spinning routine
     if (host_.coordinator_.TryStartSpinning()) {
-      Task* task = nullptr;
-
-      if ((task = TryStealTasks()) == nullptr) {
-        task = TryGrabTasksFromGlobalQueue();
-      }
+      Task* task = SpinForTask();
 
       if (host_.coordinator_.StopSpinning() && task != nullptr) {
         host_.TryWakeWorkers();
@@ -49,9 +63,40 @@ Task* Worker::PickTask() {
         return nullptr;
       }
 
+      // Sleep until the nearest deadline if we are the timekeeper
+      auto timeout = host_.timers_.TryBecomeTimekeeper(this);
+
+      if (timeout == std::chrono::milliseconds(0)) {
+        host_.coordinator_.CancelPark();
+        continue;
+      }
+
+      // Elastic pool: wake up to check if we've been idle for too long
+      if (host_.elasticity_) {
+        const auto idle_timeout = host_.elasticity_->idle_timeout;
+        timeout = timeout ? std::min(*timeout, idle_timeout) : idle_timeout;
+      }
+
       host_.work_count_.Done(1);
 
-      host_.coordinator_.TryParkMe(old);
+      const auto parked_at = std::chrono::steady_clock::now();
+
+      host_.coordinator_.TryParkMe(old, timeout);
+
+      const auto slept = std::chrono::steady_clock::now() - parked_at;
+
+      if (host_.parking_policy_.adaptive &&
+          host_.parking_policy_.max_spin_rounds > 0) {
+        spin_budget_.Parked(slept, host_.parking_policy_);
+      }
+
+      host_.timers_.RetireTimekeeper(this);
+
+      if (ShouldRetire(old, slept) && host_.TryRetire(*this)) {
+        // share of work_count_ was given up before parking
+        logger_shard_->Increment(Metric::WorkersRetired, 1);
+        return nullptr;
+      }
 
       host_.work_count_.Add(1);
     }
@@ -60,6 +105,51 @@ Task* Worker::PickTask() {
   return nullptr;
 }
 
+bool Worker::ShouldRetire(uint32_t old_wakeups,
+                          std::chrono::nanoseconds slept) {
+  if (!host_.elasticity_ || slept < host_.elasticity_->idle_timeout) {
+    return false;
+  }
+
+  // Woken up on purpose
+  if (wakeups_.load(std::memory_order::relaxed) != old_wakeups) {
+    return false;
+  }
+
+  // Parked workers with no timeout rely on the timekeeper
+  return !host_.timers_.HasPending();
+}
+
+Task* Worker::SpinForTask() {
+  const ParkingPolicy& policy = host_.parking_policy_;
+  const size_t rounds = spin_budget_.Rounds(policy);
+
+  Backoff backoff{policy};
+
+  for (size_t round = 0;; ++round) {
+    Task* task = nullptr;
+
+    if ((task = TryStealTasks()) == nullptr) {
+      task = TryGrabTasksFromGlobalQueue();
+    }
+
+    if (task != nullptr) {
+      if (round > 0) {
+        logger_shard_->Increment(Metric::FoundWhileSpinning, 1);
+        spin_budget_.Hit(round);
+      }
+
+      return task;
+    }
+
+    if (round >= rounds || StopRequested()) {
+      return nullptr;
+    }
+
+    backoff();
+  }
+}
+
 Task* Worker::TryPickTaskBeforePark() {
   if (Task* task = TryPickTaskFromLocalQueueSlow(); task != nullptr) {
     return task;
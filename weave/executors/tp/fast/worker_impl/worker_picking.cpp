@@ -14,7 +14,7 @@ Task* Worker::TryPickTask() {
   // check global queue occasionally
   if (iter_ % kVyukovGQueue == 0) {
     if ((task = TryGrabTasksFromGlobalQueue()) != nullptr) {
-      logger_shard_->Increment("Launched from global queue", 1);
+      logger_shard_->Increment(Metric::LaunchedFromGlobalQueue, 1);
 
       return task;
     }
@@ -22,7 +22,7 @@ Task* Worker::TryPickTask() {
 
   // check LIFO slot
   if ((task = TryPickTaskFromLifoSlot()) != nullptr) {
-    logger_shard_->Increment("Launched from lifo", 1);
+    logger_shard_->Increment(Metric::LaunchedFromLifo, 1);
 
     return task;
   }
@@ -33,13 +33,24 @@ Task* Worker::TryPickTask() {
 }
 
 Task* Worker::TryGrabTasksFromGlobalQueue() {
-  Task* next = host_.global_tasks_.TryPop();
+  const size_t nodes = host_.NumNodes();
+
+  Task* next = nullptr;
+
+  // own node first
+  for (size_t i = 0; i < nodes && next == nullptr; ++i) {
+    next = host_.NodeQueue((node_ + i) % nodes).TryPop();
+  }
 
   if (next != nullptr && TaskFlags::IsSet(next->flags, TaskFlags::External)) {
     TaskFlags::Reset(next->flags, TaskFlags::External);
     host_.work_count_.StealthDone(1);
   }
 
+  if (next != nullptr) {
+    TraceLatency(next, Latency::FromGlobalQueue);
+  }
+
   return next;
 }
 
@@ -59,7 +70,7 @@ Task* Worker::TryPickTaskFromLifoSlot() {
     // to reset the counter in this TryPickTask iteration
     lifo_streak_ = 0;
 
-    logger_shard_->Increment("Discarded lifo_slots", 1);
+    logger_shard_->Increment(Metric::DiscardedLifoSlots, 1);
 
     // push task from lifo_slot to local queue
     PushToLocalQueue(next);
@@ -68,6 +79,10 @@ Task* Worker::TryPickTaskFromLifoSlot() {
     return nullptr;
   }
 
+  if (next != nullptr) {
+    TraceLatency(next, Latency::FromLifo);
+  }
+
   return next;
 }
 
@@ -79,7 +94,8 @@ Task* Worker::TryPickTaskFromLocalQueueFast() {
     // reset lifo streak and return task
     lifo_streak_ = 0;
 
-    logger_shard_->Increment("Launched from local queue", 1);
+    logger_shard_->Increment(Metric::LaunchedFromLocalQueue, 1);
+    TraceLatency(task, Latency::FromLocalQueue);
 
     return task;
   }
@@ -94,7 +110,7 @@ Task* Worker::TryPickTaskFromLocalQueueSlow() {
   std::array<Task*, kLocalQueueCapacity> buffer{};
 
   // write into the buffer from GlobalQueue
-  size_t num_taken = host_.global_tasks_.Grab(buffer, host_.threads_);
+  size_t num_taken = GrabTasksFromGlobalQueues(buffer);
   if (num_taken != 0) {
     // Work count processing
     size_t external_tasks = 0;
@@ -109,10 +125,11 @@ Task* Worker::TryPickTaskFromLocalQueueSlow() {
     // we found task to return -> reset lifo streak
     lifo_streak_ = 0;
 
-    logger_shard_->Increment("Launched from global queue", 1);
+    logger_shard_->Increment(Metric::LaunchedFromGlobalQueue, 1);
 
     // grab first task for yourself and push the rest into the empty local queue
     task = buffer[0];
+    TraceLatency(task, Latency::FromGlobalQueue);
 
     local_tasks_.PushMany({buffer.begin() + 1, buffer.begin() + num_taken});
   }
@@ -121,4 +138,34 @@ Task* Worker::TryPickTaskFromLocalQueueSlow() {
   return task;
 }
 
+size_t Worker::GrabTasksFromGlobalQueues(std::span<Task*> out_buffer) {
+  size_t num_taken =
+      host_.NodeQueue(node_).Grab(out_buffer, host_.node_workers_[node_]);
+
+  const size_t nodes = host_.NumNodes();
+
+  // our node is dry -> help the others
+  for (size_t i = 1; i < nodes && num_taken == 0; ++i) {
+    const size_t remote = (node_ + i) % nodes;
+
+    num_taken = host_.NodeQueue(remote).Grab(out_buffer,
+                                             host_.node_workers_[remote]);
+
+    logger_shard_->Increment(Metric::GrabbedFromRemoteNode,
+                             (size_t)(num_taken != 0));
+  }
+
+  return num_taken;
+}
+
+void Worker::TraceLatency(Task* task, Latency source) {
+  if constexpr (kTraceLatency) {
+    const uint64_t enqueued = TaskFlags::Timestamp(task->flags);
+    const uint64_t now = TraceClockNow();
+
+    // clock of the submitter may be slightly ahead
+    logger_shard_->Record(source, now > enqueued ? now - enqueued : 0);
+  }
+}
+
 }  // namespace weave::executors::tp::fast
\ No newline at end of file
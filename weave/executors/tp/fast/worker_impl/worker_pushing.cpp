@@ -18,7 +18,29 @@ void Worker::Push(Task* task, SchedulerHint hint) {
 
     case SchedulerHint::Last:
       // Yielded task
-      host_.global_tasks_.Push(task);
+      host_.NodeQueue(node_).Push(task);
+      break;
+
+    default:
+      WHEELS_PANIC("Unknown Scheduler hint!\n");
+  };
+}
+
+void Worker::PushBatch(wheels::IntrusiveList<Task>& tasks,
+                       SchedulerHint hint) {
+  switch (hint) {
+    case SchedulerHint::Next:
+      // only the last task of the batch is meant to run next
+      PushToLifoSlot(tasks.PopBack());
+      PushBatchToLocalQueue(tasks);
+      break;
+
+    case SchedulerHint::UpToYou:
+      PushBatchToLocalQueue(tasks);
+      break;
+
+    case SchedulerHint::Last:
+      host_.NodeQueue(node_).Append(tasks);
       break;
 
     default:
@@ -40,7 +62,7 @@ void Worker::PushToLifoSlot(Task* task) {
   // if we've taken the valid task off the lifo slot, we send it into the local
   // queue
   if (former_lifo != nullptr) {
-    logger_shard_->Increment("Discarded lifo_slots", 1);
+    logger_shard_->Increment(Metric::DiscardedLifoSlots, 1);
 
     PushToLocalQueue(former_lifo);
   }
@@ -49,7 +71,7 @@ void Worker::PushToLifoSlot(Task* task) {
 // true if fast path
 void Worker::PushToLocalQueue(Task* task) {
   if (!local_tasks_.TryPush(task)) {
-    logger_shard_->Increment("Overflows in local queue", 1);
+    logger_shard_->Increment(Metric::LocalQueueOverflows, 1);
 
     // we have overflow
     std::array<Task*, kLocalQueueCapacity / 2 + 1> overflow{};
@@ -75,9 +97,21 @@ void Worker::PushToLocalQueue(Task* task) {
   }
 }
 
+void Worker::PushBatchToLocalQueue(wheels::IntrusiveList<Task>& tasks) {
+  local_tasks_.PushSome(tasks);
+
+  if (tasks.NonEmpty()) {
+    logger_shard_->Increment(Metric::LocalQueueOverflows, 1);
+
+    // whatever did not fit goes to the global queue in one go
+    host_.NodeQueue(node_).Append(tasks);
+  }
+}
+
 void Worker::OffloadTasksToGlobalQueue(std::span<Task*> overflow,
                                        size_t valid_num) {
-  host_.global_tasks_.Append({overflow.begin(), overflow.begin() + valid_num});
+  host_.NodeQueue(node_).Append(
+      {overflow.begin(), overflow.begin() + valid_num});
 }
 
 }  // namespace weave::executors::tp::fast
\ No newline at end of file
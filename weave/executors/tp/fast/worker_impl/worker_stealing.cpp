@@ -16,10 +16,16 @@ Task* Worker::TryStealTasks() {
 
   Task* task = nullptr;
 
-  logger_shard_->Increment("Steal attempts", 1);
-
-  // randomise sequence for every iter
-  std::shuffle(indices_.begin(), indices_.end(), twister_);
+  logger_shard_->Increment(Metric::StealAttempts, 1);
+
+  if (host_.steal_policy_ == StealPolicy::Random) {
+    // randomise sequence for every iter
+    // keeping the same node victims in front
+    std::shuffle(indices_.begin(), indices_.begin() + same_node_victims_,
+                 twister_);
+    std::shuffle(indices_.begin() + same_node_victims_, indices_.end(),
+                 twister_);
+  }
 
   for (size_t i = 0; i < steal_attempts && task == nullptr; i++) {
     task = TryStealTaskIter();
@@ -29,30 +35,125 @@ Task* Worker::TryStealTasks() {
 }
 
 Task* Worker::TryStealTaskIter() {
-  Task* task = nullptr;
   std::array<Task*, kLocalQueueCapacity / 2> buffer{};
-  const size_t max_index = host_.threads_;
 
-  for (auto offset : indices_) {
-    // we try to steal from worker and if we steal something we assign it to
-    // task
+  size_t num_stolen = host_.steal_policy_ == StealPolicy::LoadAware
+                          ? StealLoadAware(buffer)
+                          : StealRandom(buffer);
+
+  // nothing stolen
+  if (num_stolen == 0) {
+    return nullptr;
+  }
+
+  lifo_streak_ = 0;
+  // push surplus into local queue
+  local_tasks_.PushMany({buffer.begin() + 1, buffer.begin() + num_stolen});
 
+  TraceLatency(buffer[0], Latency::Stolen);
+
+  return buffer[0];
+}
+
+size_t Worker::StealRandom(std::span<Task*> buffer) {
+  for (size_t i = 0; i < indices_.size(); ++i) {
     size_t num_stolen =
-        host_.workers_[(index_ + offset) % (max_index)].StealTasks(buffer);
+        TryStealFrom((index_ + indices_[i]) % host_.threads_, buffer);
 
-    // we have stolen something
     if (num_stolen != 0) {
-      task = buffer[0];
+      return num_stolen;
+    }
+  }
 
-      lifo_streak_ = 0;
-      // push surplus into local queue
-      local_tasks_.PushMany({buffer.begin() + 1, buffer.begin() + num_stolen});
+  return 0;
+}
 
-      break;
+size_t Worker::StealLoadAware(std::span<Task*> buffer) {
+  // whoever had surplus last time probably still has it
+  if (last_victim_ != kNoVictim) {
+    if (size_t num_stolen = TryStealFrom(last_victim_, buffer)) {
+      logger_shard_->Increment(Metric::StolenFromLastVictim, 1);
+      return num_stolen;
     }
+
+    last_victim_ = kNoVictim;
   }
 
-  return task;
+  if (size_t num_stolen = SampleAndSteal(0, same_node_victims_, buffer)) {
+    return num_stolen;
+  }
+
+  return SampleAndSteal(same_node_victims_, indices_.size(), buffer);
+}
+
+size_t Worker::SampleAndSteal(size_t begin, size_t end,
+                              std::span<Task*> buffer) {
+  const size_t count = end - begin;
+  if (count == 0) {
+    return 0;
+  }
+
+  // as many samples as victims, same as one sweep of StealRandom
+  const size_t rounds = (count + kStealChoices - 1) / kStealChoices;
+
+  for (size_t round = 0; round < rounds; ++round) {
+    size_t best = kNoVictim;
+    size_t best_load = 0;
+
+    for (size_t i = 0; i < std::min(kStealChoices, count); ++i) {
+      const size_t victim =
+          (index_ + indices_[begin + twister_() % count]) % host_.threads_;
+
+      Worker& candidate = host_.workers_[victim];
+
+      // parked
+      if (candidate.idle_.load(std::memory_order::relaxed)) {
+        continue;
+      }
+
+      // two loads instead of a failed Grab
+      const size_t load = candidate.LocalQueueSize();
+      if (load > best_load) {
+        best = victim;
+        best_load = load;
+      }
+    }
+
+    if (best == kNoVictim) {
+      continue;
+    }
+
+    if (size_t num_stolen = TryStealFrom(best, buffer)) {
+      last_victim_ = best;
+      return num_stolen;
+    }
+  }
+
+  return 0;
+}
+
+size_t Worker::TryStealFrom(size_t victim, std::span<Task*> buffer) {
+  Worker& target = host_.workers_[victim];
+
+  // parked worker has nothing to steal
+  if (target.idle_.load(std::memory_order::relaxed)) {
+    return 0;
+  }
+
+  logger_shard_->Increment(Metric::StealProbes, 1);
+
+  size_t num_stolen = target.StealTasks(buffer);
+
+  if (num_stolen == 0) {
+    logger_shard_->Increment(Metric::EmptyStealProbes, 1);
+  } else {
+    logger_shard_->Increment(host_.worker_nodes_[victim] == node_
+                                 ? Metric::StolenFromSameNode
+                                 : Metric::StolenFromRemoteNode,
+                             1);
+  }
+
+  return num_stolen;
 }
 
 // try steal from LIFO then try steal from local queue anyway
@@ -81,7 +182,7 @@ size_t Worker::StealTasks(std::span<Task*> out_buffer) {
       local_tasks_.Grab({out_buffer.begin() + offset, out_buffer.end()});
 
   Worker::Current()->logger_shard_->Increment(
-      "Stolen from local queue", (size_t)(stolen_from_local_queue != 0));
+      Metric::StolenFromLocalQueue, (size_t)(stolen_from_local_queue != 0));
 
   return stolen_from_local_queue;
 }
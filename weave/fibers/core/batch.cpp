@@ -0,0 +1,25 @@
+#include <weave/fibers/core/batch.hpp>
+
+#include <weave/fibers/core/fiber.hpp>
+
+namespace weave::fibers {
+
+void BatchScheduler::Add(FiberHandle handle) {
+  Fiber* fiber = handle.Release();
+
+  // batches never mix schedulers
+  if (fiber->GetScheduler() != sched_) {
+    Flush();
+    sched_ = fiber->GetScheduler();
+  }
+
+  batch_.PushBack(static_cast<executors::Task*>(fiber));
+}
+
+void BatchScheduler::Flush(executors::SchedulerHint hint) {
+  if (batch_.NonEmpty()) {
+    sched_->SubmitBatch(batch_, hint);
+  }
+}
+
+}  // namespace weave::fibers
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <weave/executors/task.hpp>
+
+#include <weave/fibers/core/handle.hpp>
+#include <weave/fibers/core/scheduler.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+namespace weave::fibers {
+
+// Collects fibers which are woken up together
+// and submits them with one SubmitBatch call per scheduler
+
+class BatchScheduler {
+ public:
+  BatchScheduler() = default;
+
+  // Non-copyable
+  BatchScheduler(const BatchScheduler&) = delete;
+  BatchScheduler& operator=(const BatchScheduler&) = delete;
+
+  // Non-movable
+  BatchScheduler(BatchScheduler&&) = delete;
+  BatchScheduler& operator=(BatchScheduler&&) = delete;
+
+  // Fiber is scheduled on Flush at the latest
+  void Add(FiberHandle handle);
+
+  void Flush(
+      executors::SchedulerHint hint = executors::SchedulerHint::UpToYou);
+
+  ~BatchScheduler() {
+    Flush();
+  }
+
+ private:
+  Scheduler* sched_{nullptr};
+  wheels::IntrusiveList<executors::Task> batch_{};
+};
+
+}  // namespace weave::fibers
@@ -1,18 +1,37 @@
 #include <weave/fibers/core/fiber.hpp>
+#include <weave/fibers/core/time_slice.hpp>
 
-#include <wheels/core/panic.hpp>
+#include <wheels/core/assert.hpp>
 
 namespace weave::fibers {
 
+Fiber::~Fiber() {
+  coro::StackAllocator::Instance().Release(std::move(stack_));
+}
+
 void Fiber::Schedule(executors::SchedulerHint hint) {
   // pre Submit handling bit
   my_sched_->Submit(this, hint);
 }
 
 void Fiber::Switch() {
-  WHEELS_PANIC(
-      "Oh, so you really like switching, huh? That's great, but how about you "
-      "\"Switch\" to not using this function?");
+  Fiber* self = Self();
+
+  if (self == nullptr || self->my_sched_ != my_sched_) {
+    // this carrier can't run us
+    Schedule(executors::SchedulerHint::Next);
+    return;
+  }
+
+  WHEELS_ASSERT(self != this, "Fiber can't switch to itself");
+
+  // RunLoop resumes us once self is suspended
+  auto switch_awaiter = [this](FiberHandle) {
+    return FiberHandle(this);
+  };
+
+  self->SetAwaiter(switch_awaiter);
+  self->Suspend();
 }
 
 void Fiber::Suspend() {
@@ -54,9 +73,14 @@ FiberHandle Fiber::RunLoop(FiberHandle handle) {
     running_fiber->epoch_count_--;
   }
 
-  // reschedule in case of symm transfer
+  // reschedule in case of symm transfer, running_fiber gave its turn away
   if (next_fiber.IsValid() && next_fiber.fiber_ != running_fiber) {
-    running_fiber->Schedule();
+    running_fiber->Schedule(executors::SchedulerHint::Next);
+
+    // next fiber must not inherit the slice of the running one
+    if (SliceTracker* slice = SliceTracker::Current()) {
+      slice->Restart();
+    }
   }
 
   return next_fiber;
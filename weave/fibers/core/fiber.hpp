@@ -3,6 +3,7 @@
 #include <weave/cancel/never.hpp>
 
 #include <weave/coro/core.hpp>
+#include <weave/coro/stack_allocator.hpp>
 
 #include <weave/executors/task.hpp>
 
@@ -10,6 +11,7 @@
 #include <weave/fibers/core/handle.hpp>
 
 #include <weave/fibers/core/scheduler.hpp>
+#include <weave/fibers/core/stack_size.hpp>
 
 #include <twist/ed/local/var.hpp>
 
@@ -33,8 +35,14 @@ class Fiber : public executors::Task,
     return my_token_;
   }
 
-  // Just throws at this point
-  // Use Suspend with function which returns you the handle you wanna switch to
+  Scheduler* GetScheduler() {
+    return my_sched_;
+  }
+
+  // Symmetric transfer: suspends the running fiber and resumes this one
+  // on the same carrier without going through the scheduler queues.
+  // The suspended fiber is scheduled to run next.
+  // Outside of a fiber or across schedulers falls back to Schedule
   void Switch();
 
   void Suspend();
@@ -46,20 +54,24 @@ class Fiber : public executors::Task,
 
   template <typename Function>
   requires std::invocable<Function> Fiber(Scheduler& scheduler,
-                                          Function function)
+                                          Function function,
+                                          StackSize stack_size = {})
       : my_sched_(&scheduler),
-        stack_(sure::Stack::AllocateBytes(coro::kDefaultStackSize)),
+        stack_(coro::StackAllocator::Instance().Allocate(stack_size.bytes)),
         my_task_(
             [function = std::move(function)]() mutable noexcept {
               function();
             },
-            &stack_) {
+            stack_.MutView()) {
   }
 
+  // Returns stack to the allocator
+  ~Fiber() override;
+
   template <typename Function>
   requires std::invocable<Function>
-  void GoChild(Function function) {
-    Fiber* child = new Fiber(*my_sched_, std::move(function));
+  void GoChild(Function function, StackSize stack_size = {}) {
+    Fiber* child = new Fiber(*my_sched_, std::move(function), stack_size);
 
     child->Schedule();
   }
@@ -85,7 +97,7 @@ class Fiber : public executors::Task,
  private:
   Scheduler* my_sched_;
 
-  sure::Stack stack_;
+  coro::Stack stack_;
   coro::Coroutine my_task_;
 
   Awaiter awaiter_{DefaultAwaiter};
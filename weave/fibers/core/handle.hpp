@@ -8,10 +8,13 @@ namespace weave::fibers {
 
 class FiberHandle;
 
+class BatchScheduler;
+
 // Lightweight non-owning handle to a _suspended_ fiber
 
 class FiberHandle {
   friend class Fiber;
+  friend class BatchScheduler;
 
  public:
   FiberHandle()
@@ -33,7 +36,7 @@ class FiberHandle {
       executors::SchedulerHint hint = executors::SchedulerHint::UpToYou);
 
   // Switch to this fiber immediately
-  // For symmetric transfer
+  // For symmetric transfer, see Fiber::Switch
   void Switch();
 
  private:
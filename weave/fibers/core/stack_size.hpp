@@ -0,0 +1,38 @@
+#pragma once
+
+#include <weave/coro/core.hpp>
+
+#include <cstdlib>
+
+namespace weave::fibers {
+
+// Stack size of a single fiber
+// Rounded up to the nearest size class of coro::StackAllocator
+
+struct StackSize {
+  size_t bytes{coro::kDefaultStackSize};
+
+  static StackSize Default() {
+    return {};
+  }
+
+  // Short protocol handlers that do not recurse
+  static StackSize Tiny() {
+    return {8 * 1024};
+  }
+
+  static StackSize Small() {
+    return {16 * 1024};
+  }
+
+  // Parsers and other deep call chains
+  static StackSize Large() {
+    return {256 * 1024};
+  }
+
+  static StackSize Bytes(size_t bytes) {
+    return {bytes};
+  }
+};
+
+}  // namespace weave::fibers
@@ -0,0 +1,17 @@
+#include <weave/fibers/core/time_slice.hpp>
+
+#include <twist/ed/local/ptr.hpp>
+
+namespace weave::fibers {
+
+TWISTED_THREAD_LOCAL_PTR(SliceTracker, current_tracker);
+
+SliceTracker* SliceTracker::Current() {
+  return current_tracker;
+}
+
+void SliceTracker::SetCurrent(SliceTracker* tracker) {
+  current_tracker = tracker;
+}
+
+}  // namespace weave::fibers
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <chrono>
+#include <cstdint>
+
+namespace weave::fibers {
+
+// Time slice of a task running on a carrier thread
+// Checked at suspension points (satellite::PollToken, channel ops,
+// Mutex::Lock and MaybeYield), an expired slice makes them reschedule
+// the fiber. Unlike Yield, this never polls the cancel token
+
+struct TimeSlice {
+  // Zero disables slicing
+  std::chrono::microseconds budget{0};
+
+  // Let a watchdog thread read the clock and raise preemption requests,
+  // checks become a single load
+  bool watchdog{false};
+};
+
+// Slice of the task currently running on a carrier thread
+
+class SliceTracker {
+  using Clock = std::chrono::steady_clock;
+
+ public:
+  explicit SliceTracker(TimeSlice slice)
+      : budget_(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    slice.budget)
+                    .count()),
+        watchdog_(slice.watchdog) {
+  }
+
+  // Carrier picked a new task or switched to another fiber
+  void Restart() {
+    start_.store(Now(), std::memory_order::relaxed);
+    preemption_requested_.store(false, std::memory_order::relaxed);
+  }
+
+  bool Expired() {
+    if (preemption_requested_.load(std::memory_order::relaxed)) {
+      return true;
+    }
+
+    return !watchdog_ && Now() - start_.load(std::memory_order::relaxed) >=
+                             budget_;
+  }
+
+  // Watchdog only
+  // A request may land on the next task, that only costs it a Yield
+  void Inspect(int64_t now) {
+    if (now - start_.load(std::memory_order::relaxed) >= budget_) {
+      preemption_requested_.store(true, std::memory_order::relaxed);
+    }
+  }
+
+  static int64_t Now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Clock::now().time_since_epoch())
+        .count();
+  }
+
+  // Tracker of this carrier thread, nullptr if slicing is off
+  static SliceTracker* Current();
+
+  static void SetCurrent(SliceTracker* tracker);
+
+ private:
+  const int64_t budget_;
+  const bool watchdog_;
+
+  twist::ed::stdlike::atomic<int64_t> start_{Now()};
+  twist::ed::stdlike::atomic<bool> preemption_requested_{false};
+};
+
+}  // namespace weave::fibers
@@ -0,0 +1,172 @@
+#include <weave/fibers/sched/blocking.hpp>
+
+#include <weave/fibers/core/fiber.hpp>
+#include <weave/fibers/sched/suspend.hpp>
+
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+#include <twist/ed/wait/futex.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <mutex>
+
+namespace weave::fibers::detail {
+
+//////////////////////////////////////////////////////////////////////
+
+struct BlockingCall : wheels::IntrusiveListNode<BlockingCall> {
+  fu2::function_view<void()> call;
+  FiberHandle fiber;
+
+  // Rethrown in the fiber after resumption
+  std::exception_ptr exception;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Spawned on demand up to max_threads_, exit after being idle for a while
+// Calls are rare and long, so a single lock is fine
+
+class HelperThreads {
+  static constexpr auto kIdleTimeout = std::chrono::seconds(10);
+  static constexpr size_t kDefaultMaxThreads = 128;
+
+ public:
+  // Never destroyed: detached helpers may outlive static destructors
+  static HelperThreads& Instance() {
+    static HelperThreads* instance = new HelperThreads{};
+    return *instance;
+  }
+
+  void Submit(BlockingCall* call) {
+    std::lock_guard lock(mutex_);
+
+    calls_.PushBack(call);
+    ++pending_;
+
+    // every idle helper takes a single call
+    if (pending_ <= idle_) {
+      auto wake_key = twist::ed::futex::PrepareWake(epoch_);
+      epoch_.fetch_add(1, std::memory_order::relaxed);
+      twist::ed::futex::WakeOne(wake_key);
+    } else if (threads_ < max_threads_) {
+      Spawn();
+    }
+    // otherwise the call waits for a busy helper
+  }
+
+  // Queued calls are left to running helpers
+  void SetMaxThreads(size_t count) {
+    std::lock_guard lock(mutex_);
+    max_threads_ = std::max<size_t>(count, 1);
+  }
+
+ private:
+  // Under mutex_
+  void Spawn() {
+    ++threads_;
+
+    twist::ed::stdlike::thread([this] {
+      Loop();
+    }).detach();
+  }
+
+  void Loop() {
+    std::unique_lock lock(mutex_);
+
+    auto idle_since = std::chrono::steady_clock::now();
+
+    while (true) {
+      if (BlockingCall* call = calls_.PopFront()) {
+        --pending_;
+        lock.unlock();
+
+        try {
+          call->call();
+        } catch (...) {
+          call->exception = std::current_exception();
+        }
+
+        // fiber is suspended so it's safe to wake it from here
+        call->fiber.Schedule();
+
+        lock.lock();
+
+        idle_since = std::chrono::steady_clock::now();
+        continue;
+      }
+
+      if (std::chrono::steady_clock::now() - idle_since >= kIdleTimeout) {
+        --threads_;
+        return;
+      }
+
+      ++idle_;
+      uint32_t epoch = epoch_.load(std::memory_order::relaxed);
+      lock.unlock();
+
+      twist::ed::futex::WaitTimed(
+          epoch_, epoch,
+          std::chrono::duration_cast<std::chrono::milliseconds>(kIdleTimeout));
+
+      lock.lock();
+      --idle_;
+    }
+  }
+
+ private:
+  threads::blocking::stdlike::Mutex mutex_;
+  wheels::IntrusiveList<BlockingCall> calls_;  // guarded by mutex_
+  size_t pending_{0};                          // guarded by mutex_
+  size_t idle_{0};                             // guarded by mutex_
+  size_t threads_{0};                          // guarded by mutex_
+  size_t max_threads_{kDefaultMaxThreads};     // guarded by mutex_
+
+  twist::ed::stdlike::atomic<uint32_t> epoch_{0};
+};
+
+//////////////////////////////////////////////////////////////////////
+
+void RunBlocking(fu2::function_view<void()> call) {
+#if defined(TWIST_FIBERS)
+  // no real blocking under the model checker
+  call();
+#else
+  if (Fiber::Self() == nullptr) {
+    call();
+    return;
+  }
+
+  BlockingCall blocking{};
+  blocking.call = call;
+
+  auto awaiter = [&blocking](FiberHandle handle) {
+    blocking.fiber = handle;
+    HelperThreads::Instance().Submit(&blocking);
+
+    return FiberHandle::Invalid();
+  };
+
+  Suspend(awaiter);
+
+  if (blocking.exception) {
+    std::rethrow_exception(blocking.exception);
+  }
+#endif
+}
+
+}  // namespace weave::fibers::detail
+
+namespace weave::fibers {
+
+void SetMaxBlockingThreads(size_t count) {
+  detail::HelperThreads::Instance().SetMaxThreads(count);
+}
+
+}  // namespace weave::fibers
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <function2/function2.hpp>
+
+#include <cstdlib>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace weave::fibers {
+
+namespace detail {
+
+// Suspends the calling fiber and runs `call` on a helper thread,
+// fiber is rescheduled once `call` returns or throws.
+// Exceptions are rethrown in the fiber
+void RunBlocking(fu2::function_view<void()> call);
+
+}  // namespace detail
+
+// Upper bound on helper threads of Blocking, 128 by default.
+// Calls beyond it wait in a queue for a helper to free up,
+// so they must not wait for each other. Idle helpers exit after 10s
+void SetMaxBlockingThreads(size_t count);
+
+// Runs a blocking call (file io, dns lookups, legacy clients etc.)
+// without stalling the worker thread the fiber is running on:
+// worker keeps serving its queues while a helper thread waits for the call
+// Outside of a fiber just calls `routine`
+
+template <typename Function>
+std::invoke_result_t<Function> Blocking(Function routine) {
+  using Result = std::invoke_result_t<Function>;
+
+  if constexpr (std::is_void_v<Result>) {
+    detail::RunBlocking(routine);
+  } else {
+    std::optional<Result> result;
+
+    detail::RunBlocking([&] {
+      result.emplace(routine());
+    });
+
+    return std::move(*result);
+  }
+}
+
+}  // namespace weave::fibers
@@ -8,15 +8,15 @@ namespace weave::fibers {
 // Considered harmful
 
 template <typename Function>
-void Go(Scheduler& scheduler, Function routine) {
-  Fiber* newbie = new Fiber(scheduler, std::move(routine));
+void Go(Scheduler& scheduler, Function routine, StackSize stack_size = {}) {
+  Fiber* newbie = new Fiber(scheduler, std::move(routine), stack_size);
 
   newbie->Schedule();
 }
 
 template <typename Function>
-void Go(Function routine) {
-  Fiber::Self()->GoChild(std::move(routine));
+void Go(Function routine, StackSize stack_size = {}) {
+  Fiber::Self()->GoChild(std::move(routine), stack_size);
 }
 
 }  // namespace weave::fibers
\ No newline at end of file
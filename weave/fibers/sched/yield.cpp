@@ -1,22 +1,50 @@
 #include <weave/fibers/sched/yield.hpp>
 
+#include <weave/fibers/core/fiber.hpp>
+#include <weave/fibers/core/time_slice.hpp>
+
 #include <weave/fibers/sched/suspend.hpp>
 
 #include <weave/satellite/satellite.hpp>
 
 namespace weave::fibers {
 
-void Yield() {
-  satellite::PollToken();
+namespace {
 
+// Just gives the carrier away, the token is left alone:
+// sync primitives calling MaybeYield must not throw
+void Reschedule() {
   auto awaiter = [](FiberHandle handle) {
     handle.Schedule(executors::SchedulerHint::Last);
     return FiberHandle::Invalid();
   };
 
   Suspend(awaiter);
+}
+
+}  // namespace
+
+void Yield() {
+  // we are giving the slice away anyway,
+  // so PollToken below must not yield on its own
+  if (SliceTracker* slice = SliceTracker::Current()) {
+    slice->Restart();
+  }
 
   satellite::PollToken();
+
+  Reschedule();
+
+  satellite::PollToken();
+}
+
+void MaybeYield() {
+  SliceTracker* slice = SliceTracker::Current();
+
+  if (slice != nullptr && slice->Expired() && Fiber::Self() != nullptr) {
+    // carrier restarts the slice when it runs us again
+    Reschedule();
+  }
 }
 
-}  // namespace weave::fibers
\ No newline at end of file
+}  // namespace weave::fibers
@@ -4,4 +4,8 @@ namespace weave::fibers {
 
 void Yield();
 
-}  // namespace weave::fibers
\ No newline at end of file
+// Reschedules the fiber if the time slice of the running task is over,
+// see TimeSlice. Never throws, cheap enough for hot loops
+void MaybeYield();
+
+}  // namespace weave::fibers
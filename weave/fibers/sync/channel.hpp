@@ -1,6 +1,7 @@
 #pragma once
 
 #include <weave/fibers/sched/suspend.hpp>
+#include <weave/fibers/sched/yield.hpp>
 
 #include <weave/fibers/sync/detail/meta.hpp>
 
@@ -17,6 +18,7 @@
 #include <deque>
 #include <memory>
 #include <optional>
+#include <utility>
 
 namespace weave::fibers {
 
@@ -45,6 +47,10 @@ class ChannelWaiter final : public ICargoWaiter<T> {
     handle_.Schedule(executors::SchedulerHint::Next);
   }
 
+  FiberHandle TakeHandle() override final {
+    return std::exchange(handle_, FiberHandle::Invalid());
+  }
+
   void WriteValue(T val) override final {
     storage_.emplace(std::move(val));
   }
@@ -83,12 +89,24 @@ class ChannelImpl {
   }
 
   void Send(T value) {
+    MaybeYield();
+
     ChannelWaiter<T> sender;
     sender.WriteValue(std::move(value));
 
     threads::blocking::stdlike::UniqueLock lock(chan_spinlock_);
 
-    if (TryCompleteSender(&sender) == RendezvousResult::Success) {
+    FiberHandle receiver;
+
+    if (TryCompleteSender(&sender, &receiver) == RendezvousResult::Success) {
+      lock.Unlock();
+
+      // value went straight to a waiting receiver:
+      // hand it our carrier, we run right after it
+      if (receiver.IsValid()) {
+        receiver.Switch();
+      }
+
       return;
     }
 
@@ -113,6 +131,8 @@ class ChannelImpl {
   }
 
   T Receive() {
+    MaybeYield();
+
     ChannelWaiter<T> receiver;
 
     threads::blocking::stdlike::UniqueLock lock(chan_spinlock_);
@@ -146,7 +166,10 @@ class ChannelImpl {
 
  private:
   // Under spinlock
-  RendezvousResult TryCompleteSender(ICargoWaiter<T>* sender) {
+  // With `handoff` a woken receiver is left there for the caller
+  // to switch to, if it allows that
+  RendezvousResult TryCompleteSender(ICargoWaiter<T>* sender,
+                                     FiberHandle* handoff = nullptr) {
     if (storage_.IsFull()) {
       // if storage is full then queue is either empty
       // (we are the first sender to observe full storage)
@@ -164,7 +187,7 @@ class ChannelImpl {
     while (ICargoWaiter<T>* next_receiver = queue_.PopFront()) {
       if (next_receiver->MarkUsed() != State::Used) {
         next_receiver->WriteValue(sender->ReadValue());
-        next_receiver->Schedule();
+        Wake(next_receiver, handoff);
         return RendezvousResult::Success;
       }
     }
@@ -205,6 +228,18 @@ class ChannelImpl {
     return RendezvousResult::Success;
   }
 
+  // Under spinlock
+  static void Wake(ICargoWaiter<T>* waiter, FiberHandle* handoff) {
+    if (handoff != nullptr) {
+      *handoff = waiter->TakeHandle();
+      if (handoff->IsValid()) {
+        return;
+      }
+    }
+
+    waiter->Schedule();
+  }
+
  private:
   const size_t capacity_;
   threads::blocking::SpinLock chan_spinlock_;  // Guards storage_
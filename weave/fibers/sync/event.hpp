@@ -40,12 +40,16 @@ class Event {
     Node* wake_list = stack_.exchange(fired, std::memory_order::acq_rel);
 
     if (wake_list != nullptr) {
+      // single submit and wakeup for the whole stack
+      BatchScheduler batch;
+
       while (wake_list->next_ != nullptr) {
         auto tmp = wake_list->AsItem();
         wake_list = wake_list->next_;
-        tmp->Schedule();
+        tmp->Schedule(batch);
       }
-      wake_list->AsItem()->Schedule();
+      wake_list->AsItem()->Schedule(batch);
+      batch.Flush();
     }
   }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <weave/fibers/sched/suspend.hpp>
+#include <weave/fibers/sched/yield.hpp>
 #include <weave/fibers/sync/waiters.hpp>
 
 #include <wheels/core/assert.hpp>
@@ -12,6 +13,8 @@ class Mutex {
   using Node = SimpleNode;
 
   void Lock() {
+    MaybeYield();
+
     Node* is_unlocked_cpy = is_unlocked;
     if (stack_.compare_exchange_strong(is_unlocked_cpy, is_locked,
                                        std::memory_order::acquire,
@@ -67,19 +70,8 @@ class Mutex {
     auto next_owner = first_in_queue_->AsItem();
     first_in_queue_ = first_in_queue_->prev_;
 
-    // schedule next owner after us
-    next_owner->Schedule(executors::SchedulerHint::Next);
-
-    // suspend with rescheduling yourself
-    auto unlock_awaiter = [](FiberHandle handle) {
-      // schedule self in local queue
-      handle.Schedule();
-
-      // return invalid because we want FiberRunner to end
-      return FiberHandle::Invalid();
-    };
-
-    Suspend(unlock_awaiter);
+    // next owner takes our carrier, we are resumed right after it
+    next_owner->Switch();
   }
 
   // BasicLockable
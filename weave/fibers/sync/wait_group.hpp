@@ -32,13 +32,17 @@ class WaitGroup {
           stack_.exchange(work_is_done, std::memory_order::acq_rel);
 
       if (wake_list != work_is_not_done_yet) {
+        // single submit and wakeup for the whole stack
+        BatchScheduler batch;
+
         while (wake_list->next_ != work_is_not_done_yet) {
           auto tmp = wake_list->AsItem();
           wake_list = wake_list->next_;
-          tmp->Schedule();
+          tmp->Schedule(batch);
         }
 
-        wake_list->AsItem()->Schedule();
+        wake_list->AsItem()->Schedule(batch);
+        batch.Flush();
       }
     }
   }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <weave/fibers/core/batch.hpp>
 #include <weave/fibers/core/handle.hpp>
 
 #include <twist/ed/stdlike/atomic.hpp>
@@ -19,6 +20,15 @@ class SimpleWaiter : public wheels::IntrusiveListNode<SimpleWaiter> {
     handle_.Schedule(hint);
   }
 
+  // Resume waiter on the current carrier right away
+  void Switch() {
+    handle_.Switch();
+  }
+
+  void Schedule(BatchScheduler& batch) {
+    batch.Add(handle_);
+  }
+
   void SetHandle(FiberHandle handle) {
     handle_ = handle;
   }
@@ -47,6 +57,12 @@ struct ICargoWaiter : public wheels::IntrusiveListNode<ICargoWaiter<T>> {
 
   virtual State MarkUsed() = 0;
 
+  // Handle to switch to instead of Schedule,
+  // invalid if waiter can only be scheduled
+  virtual FiberHandle TakeHandle() {
+    return FiberHandle::Invalid();
+  }
+
   virtual ~ICargoWaiter() = default;
 };
 
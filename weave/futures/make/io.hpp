@@ -0,0 +1,59 @@
+#pragma once
+
+#include <weave/futures/types/future.hpp>
+
+#include <weave/futures/thunks/make/io.hpp>
+
+#include <span>
+
+namespace weave::futures::io {
+
+/*
+ * Usage:
+ *
+ * char buffer[4096];
+ *
+ * auto bytes = futures::io::Read(fd, buffer, 0) | futures::Await();
+ *
+ * Buffer must outlive the future
+ * Overloads without an engine use weave::io::GlobalEngine()
+ *
+ */
+
+inline Future<size_t> auto Read(weave::io::IEngine& engine, int fd,
+                                std::span<char> buffer, uint64_t offset) {
+  return thunks::IoCall<size_t>{engine,        weave::io::IoOp::Read,
+                                fd,            buffer.data(),
+                                buffer.size(), offset};
+}
+
+inline Future<size_t> auto Read(int fd, std::span<char> buffer,
+                                uint64_t offset) {
+  return Read(weave::io::GlobalEngine(), fd, buffer, offset);
+}
+
+inline Future<size_t> auto Write(weave::io::IEngine& engine, int fd,
+                                 std::span<const char> buffer,
+                                 uint64_t offset) {
+  // never written to
+  char* data = const_cast<char*>(buffer.data());
+
+  return thunks::IoCall<size_t>{engine, weave::io::IoOp::Write, fd,
+                                data,   buffer.size(),          offset};
+}
+
+inline Future<size_t> auto Write(int fd, std::span<const char> buffer,
+                                 uint64_t offset) {
+  return Write(weave::io::GlobalEngine(), fd, buffer, offset);
+}
+
+inline Future<Unit> auto Fsync(weave::io::IEngine& engine, int fd) {
+  return thunks::IoCall<Unit>{engine, weave::io::IoOp::Fsync, fd, nullptr, 0,
+                              0};
+}
+
+inline Future<Unit> auto Fsync(int fd) {
+  return Fsync(weave::io::GlobalEngine(), fd);
+}
+
+}  // namespace weave::futures::io
@@ -69,7 +69,7 @@ class [[nodiscard]] After final : public support::NonCopyableBase {
     // SignalReceiver
     void Forward(cancel::Signal signal) override final {
       if(signal.CancelRequested()){
-        delay_.processor_->NotifyProcessor();
+        delay_.processor_->NotifyProcessor(this);
       }
     }
 
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <weave/futures/model/evaluation.hpp>
+
+#include <weave/io/engine.hpp>
+
+#include <weave/result/make/err.hpp>
+#include <weave/result/make/ok.hpp>
+
+#include <weave/support/constructor_bases.hpp>
+
+#include <cerrno>
+#include <system_error>
+#include <type_traits>
+
+namespace weave::futures::thunks {
+
+// Positioned read/write (bytes transferred) or fsync (Unit)
+
+template <typename T>
+class [[nodiscard]] IoCall final : public support::NonCopyableBase {
+ public:
+  using ValueType = T;
+
+  IoCall(io::IEngine& engine, io::IoOp op, int fd, char* buffer, size_t size,
+         uint64_t offset)
+      : engine_(&engine),
+        op_(op),
+        fd_(fd),
+        buffer_(buffer),
+        size_(size),
+        offset_(offset) {
+  }
+
+  // Movable
+  IoCall(IoCall&& that) noexcept
+      : engine_(that.engine_),
+        op_(that.op_),
+        fd_(that.fd_),
+        buffer_(that.buffer_),
+        size_(that.size_),
+        offset_(that.offset_) {
+  }
+  IoCall& operator=(IoCall&&) = delete;
+
+ private:
+  template <Consumer<ValueType> Cons>
+  class EvaluationFor final : public support::PinnedBase,
+                              public io::IoRequest,
+                              public cancel::SignalReceiver {
+    friend class IoCall;
+
+    EvaluationFor(IoCall fut, Cons& cons)
+        : cons_(cons),
+          engine_(fut.engine_) {
+      op = fut.op_;
+      fd = fut.fd_;
+      buffer = fut.buffer_;
+      size = fut.size_;
+      offset = fut.offset_;
+    }
+
+   public:
+    ~EvaluationFor() override final = default;
+
+    void Start() {
+      cons_.CancelToken().Attach(this);
+
+      engine_->Submit(this);
+    }
+
+   private:
+    // IoRequest
+    void Complete(int64_t result) noexcept override final {
+      if (result == -ECANCELED && cons_.CancelToken().CancelRequested()) {
+        cons_.Cancel(Context{});
+        return;
+      }
+
+      cons_.CancelToken().Detach(this);
+
+      if (result < 0) {
+        futures::Complete<T>(
+            cons_, result::Err(std::error_code(static_cast<int>(-result),
+                                               std::system_category())));
+      } else if constexpr (std::is_same_v<T, Unit>) {
+        futures::Complete<T>(cons_, result::Ok());
+      } else {
+        futures::Complete<T>(cons_, result::Ok(static_cast<T>(result)));
+      }
+    }
+
+    bool CancelRequested() override final {
+      return cons_.CancelToken().CancelRequested();
+    }
+
+    // SignalReceiver
+    void Forward(cancel::Signal signal) override final {
+      if (signal.CancelRequested()) {
+        engine_->Cancel(this);
+      }
+    }
+
+   private:
+    Cons& cons_;
+    io::IEngine* engine_;
+  };
+
+ public:
+  template <Consumer<ValueType> Cons>
+  Evaluation<IoCall, Cons> auto Force(Cons& cons) {
+    return EvaluationFor<Cons>(std::move(*this), cons);
+  }
+
+  void Cancellable() {
+    // No-Op
+  }
+
+ private:
+  io::IEngine* engine_;
+  io::IoOp op_;
+  int fd_;
+  char* buffer_;
+  size_t size_;
+  uint64_t offset_;
+};
+
+}  // namespace weave::futures::thunks
@@ -0,0 +1,176 @@
+#include <weave/io/async_fd.hpp>
+
+#include <weave/result/make/err.hpp>
+#include <weave/result/make/ok.hpp>
+
+#include <wheels/core/assert.hpp>
+
+#include <cerrno>
+#include <system_error>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace weave::io {
+
+static Error LastError() {
+  return std::error_code(errno, std::system_category());
+}
+
+static bool WouldBlock() {
+  return errno == EAGAIN || errno == EWOULDBLOCK;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+AsyncFd::AsyncFd(Reactor& reactor, int fd)
+    : reactor_(&reactor),
+      registration_(std::make_unique<Registration>()) {
+  WHEELS_ASSERT(fd >= 0, "AsyncFd: invalid descriptor");
+
+  ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+
+  registration_->fd = fd;
+  reactor_->Register(registration_.get());
+}
+
+AsyncFd::AsyncFd(AsyncFd&& that)
+    : reactor_(that.reactor_),
+      registration_(std::move(that.registration_)) {
+}
+
+AsyncFd& AsyncFd::operator=(AsyncFd&& that) {
+  if (this != &that) {
+    Close();
+
+    reactor_ = that.reactor_;
+    registration_ = std::move(that.registration_);
+  }
+
+  return *this;
+}
+
+Result<size_t> AsyncFd::Read(std::span<char> buffer) {
+  while (true) {
+    ssize_t bytes = ::read(Fd(), buffer.data(), buffer.size());
+
+    if (bytes >= 0) {
+      return result::Ok<size_t>(bytes);
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    if (!WouldBlock()) {
+      return result::Err(LastError());
+    }
+
+    registration_->readable.Wait();
+  }
+}
+
+Result<size_t> AsyncFd::Write(std::span<const char> buffer) {
+  while (true) {
+    ssize_t bytes = ::write(Fd(), buffer.data(), buffer.size());
+
+    if (bytes >= 0) {
+      return result::Ok<size_t>(bytes);
+    }
+
+    if (errno == EINTR) {
+      continue;
+    }
+
+    if (!WouldBlock()) {
+      return result::Err(LastError());
+    }
+
+    registration_->writable.Wait();
+  }
+}
+
+Status AsyncFd::WriteAll(std::span<const char> buffer) {
+  while (!buffer.empty()) {
+    auto written = Write(buffer);
+
+    if (!written) {
+      return result::Err(written.error());
+    }
+
+    buffer = buffer.subspan(*written);
+  }
+
+  return result::Ok();
+}
+
+Result<AsyncFd> AsyncFd::Accept() {
+  while (true) {
+    int fd = ::accept4(Fd(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+
+    if (fd >= 0) {
+      return result::Ok(AsyncFd(*reactor_, fd));
+    }
+
+    if (errno == EINTR || errno == ECONNABORTED) {
+      continue;
+    }
+
+    if (!WouldBlock()) {
+      return result::Err(LastError());
+    }
+
+    registration_->readable.Wait();
+  }
+}
+
+Status AsyncFd::Connect(const sockaddr* address, unsigned address_size) {
+  if (::connect(Fd(), address, address_size) == 0) {
+    return result::Ok();
+  }
+
+  if (errno != EINPROGRESS && errno != EINTR) {
+    return result::Err(LastError());
+  }
+
+  // connection is established once the socket becomes writable,
+  // fresh sockets may report readiness before that
+  while (true) {
+    registration_->writable.Wait();
+
+    int error = 0;
+    socklen_t error_size = sizeof(error);
+    ::getsockopt(Fd(), SOL_SOCKET, SO_ERROR, &error, &error_size);
+
+    if (error != 0) {
+      return result::Err(std::error_code(error, std::system_category()));
+    }
+
+    sockaddr_storage peer{};
+    socklen_t peer_size = sizeof(peer);
+
+    if (::getpeername(Fd(), reinterpret_cast<sockaddr*>(&peer), &peer_size) ==
+        0) {
+      return result::Ok();
+    }
+
+    if (errno != ENOTCONN) {
+      return result::Err(LastError());
+    }
+  }
+}
+
+void AsyncFd::Close() {
+  if (!IsValid()) {
+    return;
+  }
+
+  const int fd = registration_->fd;
+
+  reactor_->Deregister(std::move(registration_));
+  ::close(fd);
+}
+
+}  // namespace weave::io
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <weave/io/reactor.hpp>
+
+#include <weave/result/types/result.hpp>
+#include <weave/result/types/status.hpp>
+
+#include <memory>
+#include <span>
+
+struct sockaddr;
+
+namespace weave::io {
+
+// Non-blocking descriptor (socket, pipe, eventfd...) watched by a Reactor
+// Operations suspend the calling fiber instead of blocking its worker,
+// call them from fibers only
+// At most one fiber reads and one fiber writes at a time
+
+class AsyncFd {
+ public:
+  AsyncFd() = default;
+
+  // Takes ownership of `fd` and switches it to the non-blocking mode
+  AsyncFd(Reactor& reactor, int fd);
+
+  // Non-copyable
+  AsyncFd(const AsyncFd&) = delete;
+  AsyncFd& operator=(const AsyncFd&) = delete;
+
+  // Movable
+  AsyncFd(AsyncFd&& that);
+  AsyncFd& operator=(AsyncFd&& that);
+
+  bool IsValid() const {
+    return registration_ != nullptr;
+  }
+
+  int Fd() const {
+    return IsValid() ? registration_->fd : -1;
+  }
+
+  // 0 means end of stream
+  Result<size_t> Read(std::span<char> buffer);
+
+  // Might write less than asked for
+  Result<size_t> Write(std::span<const char> buffer);
+
+  // Loops over Write
+  Status WriteAll(std::span<const char> buffer);
+
+  // Listening socket only
+  Result<AsyncFd> Accept();
+
+  // Socket created with AsyncFd but not connected yet
+  Status Connect(const sockaddr* address, unsigned address_size);
+
+  void Close();
+
+  ~AsyncFd() {
+    Close();
+  }
+
+ private:
+  Reactor* reactor_{nullptr};
+  std::unique_ptr<Registration> registration_{};
+};
+
+}  // namespace weave::io
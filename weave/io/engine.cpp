@@ -0,0 +1,21 @@
+#include <weave/io/engine.hpp>
+
+#include <weave/io/engines/thread_pool.hpp>
+#include <weave/io/engines/uring.hpp>
+
+namespace weave::io {
+
+std::unique_ptr<IEngine> MakeEngine() {
+  if (auto uring = UringEngine::TryCreate()) {
+    return uring;
+  }
+
+  return std::make_unique<ThreadPoolEngine>();
+}
+
+IEngine& GlobalEngine() {
+  static std::unique_ptr<IEngine> engine = MakeEngine();
+  return *engine;
+}
+
+}  // namespace weave::io
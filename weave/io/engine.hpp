@@ -0,0 +1,57 @@
+#pragma once
+
+#include <wheels/intrusive/list.hpp>
+
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+
+namespace weave::io {
+
+//////////////////////////////////////////////////////////////////////
+
+enum class IoOp : uint8_t { Read, Write, Fsync };
+
+// Single positioned operation on a file descriptor
+// Owned by the caller until Complete
+
+struct IoRequest : public wheels::IntrusiveListNode<IoRequest> {
+  virtual ~IoRequest() = default;
+
+  IoOp op{IoOp::Read};
+  int fd{-1};
+  char* buffer{nullptr};
+  size_t size{0};
+  uint64_t offset{0};
+
+  // Assigned by the engine, tells reused requests apart
+  uint64_t id{0};
+
+  // Number of bytes or -errno, called from an engine thread
+  virtual void Complete(int64_t result) noexcept = 0;
+
+  // Engines may skip operations which have not started yet
+  virtual bool CancelRequested() = 0;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+struct IEngine {
+  virtual void Submit(IoRequest* request) = 0;
+
+  // Best effort: request still completes, with -ECANCELED if it was stopped
+  // Request must not be completed yet
+  virtual void Cancel(IoRequest* request) = 0;
+
+  virtual ~IEngine() = default;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// io_uring if the kernel lets us, thread pool otherwise
+std::unique_ptr<IEngine> MakeEngine();
+
+// Lazily created with MakeEngine
+IEngine& GlobalEngine();
+
+}  // namespace weave::io
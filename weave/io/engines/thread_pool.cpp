@@ -0,0 +1,61 @@
+#include <weave/io/engines/thread_pool.hpp>
+
+#include <cerrno>
+
+#include <unistd.h>
+
+namespace weave::io {
+
+ThreadPoolEngine::ThreadPoolEngine(size_t threads) {
+  for (size_t i = 0; i < threads; ++i) {
+    workers_.emplace_back([this] {
+      Worker();
+    });
+  }
+}
+
+void ThreadPoolEngine::Submit(IoRequest* request) {
+  requests_.Put(request);
+}
+
+void ThreadPoolEngine::Cancel(IoRequest* /*request*/) {
+  // worker checks CancelRequested before the syscall
+}
+
+void ThreadPoolEngine::Worker() {
+  while (IoRequest* request = requests_.Take()) {
+    if (request->CancelRequested()) {
+      request->Complete(-ECANCELED);
+      continue;
+    }
+
+    int64_t result = 0;
+
+    switch (request->op) {
+      case IoOp::Read:
+        result = ::pread(request->fd, request->buffer, request->size,
+                         request->offset);
+        break;
+      case IoOp::Write:
+        result = ::pwrite(request->fd, request->buffer, request->size,
+                          request->offset);
+        break;
+      case IoOp::Fsync:
+        result = ::fsync(request->fd);
+        break;
+    }
+
+    request->Complete(result < 0 ? -errno : result);
+  }
+}
+
+ThreadPoolEngine::~ThreadPoolEngine() {
+  // requests left in the queue are still served
+  requests_.Close();
+
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+}  // namespace weave::io
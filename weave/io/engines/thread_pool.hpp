@@ -0,0 +1,44 @@
+#pragma once
+
+#include <weave/io/engine.hpp>
+
+#include <weave/threads/blocking/unbounded_blocking_queue.hpp>
+
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <vector>
+
+namespace weave::io {
+
+// Fallback for kernels without io_uring:
+// every operation is a blocking syscall on one of the pool threads
+// Cancellation only skips operations which have not started yet
+
+class ThreadPoolEngine : public IEngine {
+ public:
+  explicit ThreadPoolEngine(size_t threads = 4);
+
+  // Non-copyable
+  ThreadPoolEngine(const ThreadPoolEngine&) = delete;
+  ThreadPoolEngine& operator=(const ThreadPoolEngine&) = delete;
+
+  // Non-movable
+  ThreadPoolEngine(ThreadPoolEngine&&) = delete;
+  ThreadPoolEngine& operator=(ThreadPoolEngine&&) = delete;
+
+  // IEngine
+  void Submit(IoRequest* request) override;
+
+  void Cancel(IoRequest* request) override;
+
+  ~ThreadPoolEngine() override;
+
+ private:
+  void Worker();
+
+ private:
+  threads::blocking::UnboundedBlockingQueue<IoRequest> requests_;
+  std::vector<twist::ed::stdlike::thread> workers_;
+};
+
+}  // namespace weave::io
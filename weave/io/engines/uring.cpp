@@ -0,0 +1,488 @@
+#include <weave/io/engines/uring.hpp>
+
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <wheels/core/assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <utility>
+#include <vector>
+
+#if !defined(TWIST_FIBERS) && LINUX
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace weave::io {
+
+struct UringEngine::CancelRequest
+    : public wheels::IntrusiveListNode<CancelRequest> {
+  IoRequest* target;
+  uint64_t id;
+};
+
+#if !defined(TWIST_FIBERS) && LINUX && defined(__NR_io_uring_setup)
+
+//////////////////////////////////////////////////////////////////////
+
+// user_data tags: requests and cancels are at least 8-byte aligned
+static const uint64_t kWakeupTag = 0;
+static const uint64_t kCancelTag = 1;
+
+static int Setup(unsigned entries, io_uring_params* params) {
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+static int Enter(int ring_fd, unsigned to_submit, unsigned min_complete,
+                 unsigned flags) {
+  return static_cast<int>(::syscall(__NR_io_uring_enter, ring_fd, to_submit,
+                                    min_complete, flags, nullptr, 0));
+}
+
+static int Register(int ring_fd, unsigned opcode, void* arg, unsigned nr_args) {
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, ring_fd, opcode, arg, nr_args));
+}
+
+// IORING_OP_READ/WRITE came in 5.6 together with the probe,
+// older kernels accept the ring but fail every request with -EINVAL
+static bool SupportsOps(int ring_fd) {
+  static const unsigned kMaxOps = 256;
+
+  // io_uring_probe ends with a flexible array of ops
+  std::vector<io_uring_probe_op> storage(
+      kMaxOps + sizeof(io_uring_probe) / sizeof(io_uring_probe_op));
+  auto* probe = reinterpret_cast<io_uring_probe*>(storage.data());
+
+  if (Register(ring_fd, IORING_REGISTER_PROBE, probe, kMaxOps) < 0) {
+    return false;
+  }
+
+  for (unsigned op : {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_FSYNC,
+                      IORING_OP_ASYNC_CANCEL}) {
+    if (op > probe->last_op ||
+        (probe->ops[op].flags & IO_URING_OP_SUPPORTED) == 0) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <typename T>
+static T* At(void* base, uint32_t offset) {
+  return reinterpret_cast<T*>(static_cast<char*>(base) + offset);
+}
+
+static uint32_t LoadAcquire(uint32_t* word) {
+  return std::atomic_ref<uint32_t>(*word).load(std::memory_order::acquire);
+}
+
+static void StoreRelease(uint32_t* word, uint32_t value) {
+  std::atomic_ref<uint32_t>(*word).store(value, std::memory_order::release);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+struct UringEngine::Rings {
+  io_uring_params params{};
+
+  void* sq_ring{MAP_FAILED};
+  size_t sq_ring_size{0};
+  void* cq_ring{MAP_FAILED};
+  size_t cq_ring_size{0};
+  io_uring_sqe* sqes{static_cast<io_uring_sqe*>(MAP_FAILED)};
+  size_t sqes_size{0};
+
+  uint32_t* sq_head{nullptr};
+  uint32_t* sq_tail{nullptr};
+  uint32_t sq_mask{0};
+  uint32_t* sq_array{nullptr};
+
+  uint32_t* cq_head{nullptr};
+  uint32_t* cq_tail{nullptr};
+  uint32_t cq_mask{0};
+  io_uring_cqe* cqes{nullptr};
+
+  // Filled but not yet passed to io_uring_enter
+  uint32_t to_submit{0};
+
+  // Free slots in the submission ring
+  uint32_t SqSpace() const {
+    return params.sq_entries - (*sq_tail - LoadAcquire(sq_head));
+  }
+
+  io_uring_sqe* NextSqe() {
+    const uint32_t tail = *sq_tail;
+    const uint32_t index = tail & sq_mask;
+
+    io_uring_sqe* sqe = &sqes[index];
+    *sqe = io_uring_sqe{};
+    sq_array[index] = index;
+
+    return sqe;
+  }
+
+  void CommitSqe() {
+    StoreRelease(sq_tail, *sq_tail + 1);
+    ++to_submit;
+  }
+
+  ~Rings() {
+    if (sqes != MAP_FAILED) {
+      ::munmap(sqes, sqes_size);
+    }
+
+    if (cq_ring != MAP_FAILED && cq_ring != sq_ring) {
+      ::munmap(cq_ring, cq_ring_size);
+    }
+
+    if (sq_ring != MAP_FAILED) {
+      ::munmap(sq_ring, sq_ring_size);
+    }
+  }
+};
+
+//////////////////////////////////////////////////////////////////////
+
+std::unique_ptr<UringEngine> UringEngine::TryCreate(unsigned entries) {
+  io_uring_params params{};
+
+  // Wakeup read holds a slot of its own, leave room for a request
+  int ring_fd = Setup(std::max(entries, 2u), &params);
+
+  if (ring_fd < 0) {
+    return nullptr;
+  }
+
+  if (!SupportsOps(ring_fd)) {
+    ::close(ring_fd);
+    return nullptr;
+  }
+
+  std::unique_ptr<UringEngine> engine(new UringEngine(ring_fd));
+  engine->rings_->params = params;
+
+  if (!engine->MapRings()) {
+    return nullptr;
+  }
+
+  engine->wakeup_fd_ = ::eventfd(0, EFD_CLOEXEC);
+
+  if (engine->wakeup_fd_ < 0) {
+    return nullptr;
+  }
+
+  engine->worker_ = twist::ed::stdlike::thread([raw = engine.get()] {
+    raw->Loop();
+  });
+
+  return engine;
+}
+
+UringEngine::UringEngine(int ring_fd)
+    : ring_fd_(ring_fd),
+      rings_(std::make_unique<Rings>()) {
+}
+
+bool UringEngine::MapRings() {
+  Rings& rings = *rings_;
+  const io_uring_params& params = rings.params;
+
+  rings.sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+  rings.cq_ring_size =
+      params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+  const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+
+  if (single_mmap) {
+    rings.sq_ring_size = std::max(rings.sq_ring_size, rings.cq_ring_size);
+  }
+
+  rings.sq_ring = ::mmap(nullptr, rings.sq_ring_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQ_RING);
+
+  if (rings.sq_ring == MAP_FAILED) {
+    return false;
+  }
+
+  if (single_mmap) {
+    rings.cq_ring = rings.sq_ring;
+  } else {
+    rings.cq_ring =
+        ::mmap(nullptr, rings.cq_ring_size, PROT_READ | PROT_WRITE,
+               MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_CQ_RING);
+
+    if (rings.cq_ring == MAP_FAILED) {
+      return false;
+    }
+  }
+
+  rings.sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+  rings.sqes = static_cast<io_uring_sqe*>(
+      ::mmap(nullptr, rings.sqes_size, PROT_READ | PROT_WRITE,
+             MAP_SHARED | MAP_POPULATE, ring_fd_, IORING_OFF_SQES));
+
+  if (rings.sqes == MAP_FAILED) {
+    return false;
+  }
+
+  rings.sq_head = At<uint32_t>(rings.sq_ring, params.sq_off.head);
+  rings.sq_tail = At<uint32_t>(rings.sq_ring, params.sq_off.tail);
+  rings.sq_mask = *At<uint32_t>(rings.sq_ring, params.sq_off.ring_mask);
+  rings.sq_array = At<uint32_t>(rings.sq_ring, params.sq_off.array);
+
+  rings.cq_head = At<uint32_t>(rings.cq_ring, params.cq_off.head);
+  rings.cq_tail = At<uint32_t>(rings.cq_ring, params.cq_off.tail);
+  rings.cq_mask = *At<uint32_t>(rings.cq_ring, params.cq_off.ring_mask);
+  rings.cqes = At<io_uring_cqe>(rings.cq_ring, params.cq_off.cqes);
+
+  return true;
+}
+
+void UringEngine::Submit(IoRequest* request) {
+  bool wake = false;
+
+  {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    request->id = next_id_++;
+    pending_.PushBack(request);
+
+    wake = !std::exchange(wakeup_pending_, true);
+  }
+
+  if (wake) {
+    Wake();
+  }
+}
+
+void UringEngine::Cancel(IoRequest* request) {
+  auto* cancel = new CancelRequest{};
+  cancel->target = request;
+
+  bool wake = false;
+
+  {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    cancel->id = request->id;
+    cancels_.PushBack(cancel);
+
+    wake = !std::exchange(wakeup_pending_, true);
+  }
+
+  if (wake) {
+    Wake();
+  }
+}
+
+void UringEngine::Wake() {
+  uint64_t one = 1;
+  [[maybe_unused]] auto ret = ::write(wakeup_fd_, &one, sizeof(one));
+}
+
+void UringEngine::ArmWakeup() {
+  if (rings_->SqSpace() == 0) {
+    return;
+  }
+
+  io_uring_sqe* sqe = rings_->NextSqe();
+
+  sqe->opcode = IORING_OP_READ;
+  sqe->fd = wakeup_fd_;
+  sqe->addr = reinterpret_cast<uint64_t>(&wakeup_buffer_);
+  sqe->len = sizeof(wakeup_buffer_);
+  sqe->off = static_cast<uint64_t>(-1);  // current position
+  sqe->user_data = kWakeupTag;
+
+  rings_->CommitSqe();
+  wakeup_armed_ = true;
+}
+
+void UringEngine::FillSubmissions() {
+  wheels::IntrusiveList<IoRequest> pending;
+  wheels::IntrusiveList<CancelRequest> cancels;
+
+  {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    pending.Append(pending_);
+    cancels.Append(cancels_);
+
+    wakeup_pending_ = false;
+  }
+
+  Rings& rings = *rings_;
+
+  // Wakeup read could not fit into the ring on the last reap
+  if (!wakeup_armed_) {
+    ArmWakeup();
+  }
+
+  // Cancels first, they are cheap and rare
+  while (CancelRequest* cancel = cancels.PopFront()) {
+    bool in_flight = false;
+
+    for (IoRequest& request : in_flight_) {
+      if (&request == cancel->target && request.id == cancel->id) {
+        in_flight = true;
+        break;
+      }
+    }
+
+    // already completed or not submitted yet
+    if (!in_flight || rings.SqSpace() == 0) {
+      delete cancel;
+      continue;
+    }
+
+    io_uring_sqe* sqe = rings.NextSqe();
+
+    sqe->opcode = IORING_OP_ASYNC_CANCEL;
+    sqe->fd = -1;
+    sqe->addr = reinterpret_cast<uint64_t>(cancel->target);
+    sqe->user_data = reinterpret_cast<uint64_t>(cancel) | kCancelTag;
+
+    rings.CommitSqe();
+  }
+
+  // Completion ring is twice as large, keep it from overflowing
+  while (in_flight_count_ < rings.params.sq_entries && rings.SqSpace() > 0) {
+    IoRequest* request = pending.PopFront();
+
+    if (request == nullptr) {
+      break;
+    }
+
+    if (request->CancelRequested()) {
+      request->Complete(-ECANCELED);
+      continue;
+    }
+
+    io_uring_sqe* sqe = rings.NextSqe();
+
+    sqe->fd = request->fd;
+    sqe->user_data = reinterpret_cast<uint64_t>(request);
+
+    if (request->op == IoOp::Fsync) {
+      // kernel wants the rest of the entry zeroed
+      sqe->opcode = IORING_OP_FSYNC;
+    } else {
+      sqe->opcode =
+          request->op == IoOp::Read ? IORING_OP_READ : IORING_OP_WRITE;
+      sqe->addr = reinterpret_cast<uint64_t>(request->buffer);
+      sqe->len = static_cast<uint32_t>(request->size);
+      sqe->off = request->offset;
+    }
+
+    rings.CommitSqe();
+
+    in_flight_.PushBack(request);
+    ++in_flight_count_;
+  }
+
+  // Ring is full, leftovers go first on the next tick
+  if (pending.NonEmpty()) {
+    threads::blocking::stdlike::LockGuard lock(mutex_);
+
+    pending.Append(pending_);
+    pending_.Append(pending);
+
+    wakeup_pending_ = true;
+  }
+}
+
+void UringEngine::ReapCompletions() {
+  Rings& rings = *rings_;
+
+  uint32_t head = *rings.cq_head;
+
+  while (head != LoadAcquire(rings.cq_tail)) {
+    io_uring_cqe& cqe = rings.cqes[head & rings.cq_mask];
+
+    const uint64_t user_data = cqe.user_data;
+    const int32_t result = cqe.res;
+
+    ++head;
+    StoreRelease(rings.cq_head, head);
+
+    if (user_data == kWakeupTag) {
+      wakeup_armed_ = false;
+      ArmWakeup();
+    } else if (user_data & kCancelTag) {
+      delete reinterpret_cast<CancelRequest*>(user_data & ~kCancelTag);
+    } else {
+      auto* request = reinterpret_cast<IoRequest*>(user_data);
+
+      request->Unlink();
+      --in_flight_count_;
+
+      request->Complete(result);
+    }
+  }
+}
+
+void UringEngine::Loop() {
+  Rings& rings = *rings_;
+
+  while (true) {
+    FillSubmissions();
+
+    {
+      threads::blocking::stdlike::LockGuard lock(mutex_);
+
+      if (stop_requested_ && pending_.IsEmpty() && in_flight_count_ == 0) {
+        break;
+      }
+    }
+
+    // Submit the whole tick and wait for at least one completion
+    int ret = Enter(ring_fd_, rings.to_submit, 1, IORING_ENTER_GETEVENTS);
+
+    if (ret >= 0) {
+      rings.to_submit -= std::min<uint32_t>(ret, rings.to_submit);
+    } else {
+      WHEELS_VERIFY(errno == EINTR || errno == EAGAIN || errno == EBUSY,
+                    "UringEngine: io_uring_enter failed");
+    }
+
+    ReapCompletions();
+  }
+}
+
+UringEngine::~UringEngine() {
+  if (worker_.joinable()) {
+    {
+      threads::blocking::stdlike::LockGuard lock(mutex_);
+      stop_requested_ = true;
+    }
+
+    Wake();
+    worker_.join();
+  }
+
+  // Pending eventfd read is dropped with the ring
+  rings_.reset();
+
+  if (wakeup_fd_ >= 0) {
+    ::close(wakeup_fd_);
+  }
+
+  ::close(ring_fd_);
+}
+
+#else
+
+std::unique_ptr<UringEngine> UringEngine::TryCreate(unsigned) {
+  return nullptr;
+}
+
+#endif
+
+}  // namespace weave::io
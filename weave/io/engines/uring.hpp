@@ -0,0 +1,85 @@
+#pragma once
+
+#include <weave/io/engine.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+#include <cstdint>
+#include <memory>
+
+namespace weave::io {
+
+// io_uring driven by raw syscalls, no liburing involved
+// Engine thread moves everything submitted since the last tick
+// into the submission ring, enters the kernel once per tick
+// and completes requests right from the completion ring
+
+class UringEngine : public IEngine {
+  struct CancelRequest;
+
+ public:
+  // nullptr if io_uring is not available (old kernel, seccomp etc.)
+  // or can't read and write files (before 5.6)
+  static std::unique_ptr<UringEngine> TryCreate(unsigned entries = 256);
+
+  // Non-copyable
+  UringEngine(const UringEngine&) = delete;
+  UringEngine& operator=(const UringEngine&) = delete;
+
+  // Non-movable
+  UringEngine(UringEngine&&) = delete;
+  UringEngine& operator=(UringEngine&&) = delete;
+
+  // IEngine
+  void Submit(IoRequest* request) override;
+
+  void Cancel(IoRequest* request) override;
+
+  ~UringEngine() override;
+
+ private:
+  explicit UringEngine(int ring_fd);
+
+  bool MapRings();
+
+  void Loop();
+
+  // Moves pending requests and cancels into the submission ring
+  void FillSubmissions();
+
+  void ReapCompletions();
+
+  // No-op if the submission ring is full, next FillSubmissions retries
+  void ArmWakeup();
+
+  void Wake();
+
+ private:
+  int ring_fd_{-1};
+  int wakeup_fd_{-1};
+
+  // Rings shared with the kernel
+  struct Rings;
+  std::unique_ptr<Rings> rings_;
+
+  threads::blocking::SpinLock mutex_;
+  wheels::IntrusiveList<IoRequest> pending_;           // guarded by mutex_
+  wheels::IntrusiveList<CancelRequest> cancels_;       // guarded by mutex_
+  bool wakeup_pending_{false};                         // guarded by mutex_
+  bool stop_requested_{false};                         // guarded by mutex_
+  uint64_t next_id_{1};                                // guarded by mutex_
+
+  // Engine thread only
+  wheels::IntrusiveList<IoRequest> in_flight_;
+  size_t in_flight_count_{0};
+  uint64_t wakeup_buffer_{0};
+  bool wakeup_armed_{false};
+
+  twist::ed::stdlike::thread worker_;
+};
+
+}  // namespace weave::io
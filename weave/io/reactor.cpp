@@ -0,0 +1,205 @@
+#include <weave/io/reactor.hpp>
+
+#include <weave/fibers/sched/suspend.hpp>
+#include <weave/fibers/sync/waiters.hpp>
+
+#include <weave/threads/blocking/stdlike/mutex.hpp>
+
+#include <wheels/core/panic.hpp>
+
+#if !defined(TWIST_FIBERS) && LINUX
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <unistd.h>
+#endif
+
+namespace weave::io {
+
+//////////////////////////////////////////////////////////////////////
+
+void Readiness::Notify(fibers::BatchScheduler& batch) {
+  uintptr_t state = state_.load(std::memory_order::acquire);
+
+  while (true) {
+    if (state == kNotified) {
+      return;
+    }
+
+    if (state == kEmpty) {
+      if (state_.compare_exchange_weak(state, kNotified,
+                                       std::memory_order::release,
+                                       std::memory_order::acquire)) {
+        return;
+      }
+
+      continue;
+    }
+
+    // Waiter is parked, readiness is consumed by its retry
+    if (state_.compare_exchange_weak(state, kEmpty,
+                                     std::memory_order::acq_rel,
+                                     std::memory_order::acquire)) {
+      reinterpret_cast<fibers::SimpleWaiter*>(state)->Schedule(batch);
+      return;
+    }
+  }
+}
+
+void Readiness::Wait() {
+  // fast path: readiness came before we needed it
+  if (state_.load(std::memory_order::acquire) == kNotified) {
+    state_.store(kEmpty, std::memory_order::relaxed);
+    return;
+  }
+
+  fibers::SimpleWaiter waiter;
+
+  auto awaiter = [&](fibers::FiberHandle handle) {
+    waiter.SetHandle(handle);
+
+    uintptr_t expected = kEmpty;
+
+    if (state_.compare_exchange_strong(
+            expected, reinterpret_cast<uintptr_t>(&waiter),
+            std::memory_order::acq_rel, std::memory_order::acquire)) {
+      return fibers::FiberHandle::Invalid();
+    }
+
+    // notified in between, resume right away
+    state_.store(kEmpty, std::memory_order::relaxed);
+    return handle;
+  };
+
+  fibers::Suspend(awaiter);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+#if !defined(TWIST_FIBERS) && LINUX
+
+static const size_t kMaxEvents = 256;
+
+Reactor::Reactor()
+    : epoll_fd_(::epoll_create1(EPOLL_CLOEXEC)),
+      wakeup_fd_(::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) {
+  WHEELS_VERIFY(epoll_fd_ >= 0 && wakeup_fd_ >= 0,
+                "Reactor: unable to create epoll instance");
+
+  // nullptr marks the wakeup descriptor
+  epoll_event event{};
+  event.events = EPOLLIN;
+  event.data.ptr = nullptr;
+
+  ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, wakeup_fd_, &event);
+
+  worker_ = twist::ed::stdlike::thread([this] {
+    Loop();
+  });
+}
+
+void Reactor::Register(Registration* registration) {
+  epoll_event event{};
+  event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+  event.data.ptr = registration;
+
+  int ret = ::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, registration->fd, &event);
+  WHEELS_VERIFY(ret == 0, "Reactor: unable to register fd");
+}
+
+void Reactor::Deregister(std::unique_ptr<Registration> registration) {
+  ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, registration->fd, nullptr);
+
+  threads::blocking::stdlike::LockGuard lock(retired_mutex_);
+  retired_.push_back(std::move(registration));
+}
+
+void Reactor::Loop() {
+  epoll_event events[kMaxEvents];
+
+  while (!stop_requested_.load(std::memory_order::acquire)) {
+    int ready = ::epoll_wait(epoll_fd_, events, kMaxEvents, /*timeout=*/-1);
+
+    fibers::BatchScheduler batch;
+
+    for (int i = 0; i < ready; ++i) {
+      auto* registration = static_cast<Registration*>(events[i].data.ptr);
+
+      if (registration == nullptr) {
+        uint64_t drain;
+        [[maybe_unused]] auto ret = ::read(wakeup_fd_, &drain, sizeof(drain));
+        continue;
+      }
+
+      const uint32_t flags = events[i].events;
+
+      // errors and hangups wake both sides, the retry reports them
+      if (flags & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+        registration->readable.Notify(batch);
+      }
+
+      if (flags & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+        registration->writable.Notify(batch);
+      }
+    }
+
+    batch.Flush();
+
+    // events of this round are handled, nobody points to retired ones
+    FreeRetired();
+  }
+}
+
+void Reactor::FreeRetired() {
+  std::vector<std::unique_ptr<Registration>> retired;
+
+  {
+    threads::blocking::stdlike::LockGuard lock(retired_mutex_);
+    retired.swap(retired_);
+  }
+}
+
+void Reactor::Stop() {
+  stop_requested_.store(true, std::memory_order::release);
+
+  uint64_t one = 1;
+  [[maybe_unused]] auto ret = ::write(wakeup_fd_, &one, sizeof(one));
+
+  worker_.join();
+}
+
+Reactor::~Reactor() {
+  Stop();
+
+  FreeRetired();
+
+  ::close(wakeup_fd_);
+  ::close(epoll_fd_);
+}
+
+#else
+
+Reactor::Reactor() {
+  WHEELS_PANIC("Reactor: epoll is not supported on this platform");
+}
+
+void Reactor::Register(Registration*) {
+}
+
+void Reactor::Deregister(std::unique_ptr<Registration>) {
+}
+
+void Reactor::Loop() {
+}
+
+void Reactor::FreeRetired() {
+}
+
+void Reactor::Stop() {
+}
+
+Reactor::~Reactor() {
+}
+
+#endif
+
+}  // namespace weave::io
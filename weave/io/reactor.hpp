@@ -0,0 +1,91 @@
+#pragma once
+
+#include <weave/fibers/core/batch.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace weave::io {
+
+//////////////////////////////////////////////////////////////////////
+
+// Readiness of one direction (read or write) of a descriptor
+// At most one fiber waits for it at a time
+
+class Readiness {
+  static const uintptr_t kEmpty = 0;
+  static const uintptr_t kNotified = 1;
+
+ public:
+  // Reactor side: wakes up the waiter or leaves a notification for it
+  void Notify(fibers::BatchScheduler& batch);
+
+  // Fiber side: returns right away if there is a pending notification
+  void Wait();
+
+ private:
+  // kEmpty, kNotified or fibers::SimpleWaiter*
+  twist::ed::stdlike::atomic<uintptr_t> state_{kEmpty};
+};
+
+// Pinned: epoll keeps a pointer to it
+struct Registration {
+  int fd{-1};
+
+  Readiness readable{};
+  Readiness writable{};
+};
+
+//////////////////////////////////////////////////////////////////////
+
+// Takes up one thread to wait for descriptors with epoll
+// Descriptors are registered once in edge-triggered mode
+// and woken fibers are scheduled with one batch per epoll_wait
+
+class Reactor {
+ public:
+  Reactor();
+
+  // Non-copyable
+  Reactor(const Reactor&) = delete;
+  Reactor& operator=(const Reactor&) = delete;
+
+  // Non-movable
+  Reactor(Reactor&&) = delete;
+  Reactor& operator=(Reactor&&) = delete;
+
+  // Registration should outlive the reactor or be passed to Deregister
+  void Register(Registration* registration);
+
+  // Reactor takes ownership: events of the current epoll_wait
+  // may still point to the registration
+  void Deregister(std::unique_ptr<Registration> registration);
+
+  ~Reactor();
+
+ private:
+  void Loop();
+
+  void FreeRetired();
+
+  void Stop();
+
+ private:
+  int epoll_fd_{-1};
+  int wakeup_fd_{-1};
+
+  twist::ed::stdlike::atomic<bool> stop_requested_{false};
+
+  threads::blocking::SpinLock retired_mutex_;
+  std::vector<std::unique_ptr<Registration>> retired_;  // guarded
+
+  twist::ed::stdlike::thread worker_;
+};
+
+}  // namespace weave::io
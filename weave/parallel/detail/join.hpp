@@ -0,0 +1,43 @@
+#pragma once
+
+#include <weave/fibers/core/self.hpp>
+#include <weave/fibers/sync/event.hpp>
+
+#include <weave/threads/blocking/event.hpp>
+
+namespace weave::parallel::detail {
+
+// Completion of a parallel call
+// A fiber waiter suspends and leaves its worker to other tasks,
+// a thread waiter blocks
+
+class Join {
+ public:
+  Join()
+      : fiber_(fibers::IAmFiber()) {
+  }
+
+  void Wait() {
+    if (fiber_) {
+      fiber_event_.Wait();
+    } else {
+      thread_event_.Wait();
+    }
+  }
+
+  // Waiter may destroy us right away
+  void Fire() {
+    if (fiber_) {
+      fiber_event_.Fire();
+    } else {
+      thread_event_.Set();
+    }
+  }
+
+ private:
+  const bool fiber_;
+  fibers::Event fiber_event_;
+  threads::blocking::Event thread_event_;
+};
+
+}  // namespace weave::parallel::detail
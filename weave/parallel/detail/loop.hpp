@@ -0,0 +1,244 @@
+#pragma once
+
+#include <weave/parallel/grain.hpp>
+
+#include <weave/parallel/detail/join.hpp>
+
+#include <weave/executors/task.hpp>
+#include <weave/executors/hint.hpp>
+
+#include <weave/executors/detail/task_pool.hpp>
+
+#include <weave/executors/tp/fast/thread_pool.hpp>
+#include <weave/executors/tp/fast/worker.hpp>
+
+#include <weave/fibers/core/self.hpp>
+
+#include <weave/cancel/never.hpp>
+
+#include <weave/satellite/meta_data.hpp>
+#include <weave/satellite/satellite.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <new>
+#include <utility>
+
+namespace weave::parallel {
+
+using Pool = executors::tp::fast::ThreadPool;
+
+namespace detail {
+
+using namespace std::chrono_literals;
+
+// Auto grain: a chunk should take about that long
+inline constexpr auto kTargetChunkTime = 20us;
+
+// Auto grain: timing stops after that much work
+inline constexpr auto kProbeTime = 5us;
+
+// Auto grain never exceeds size / (kChunksPerWorker * workers)
+inline const size_t kChunksPerWorker = 4;
+
+inline size_t MaxGrain(Pool& pool, size_t size) {
+  const size_t workers = std::max<size_t>(pool.ActiveWorkers(), 1);
+  return std::max<size_t>(size / (kChunksPerWorker * workers), 1);
+}
+
+// Runs body(begin, end) over disjoint chunks of [0, size)
+//
+// Lazy binary splitting: a task processes its range grain by grain
+// and splits off the upper half only when the local queue of its worker
+// is empty, i.e. when a thief would have nothing to steal. Busy pools
+// thus pay for a fork only when it can actually be picked up
+//
+// The caller runs the root range itself if it is a fiber of the pool,
+// external callers hand it over to the pool
+
+template <typename Body>
+class Loop {
+  class RangeTask final : public executors::Task {
+   public:
+    static RangeTask* Make(Loop* loop, size_t begin, size_t end) {
+      static_assert(sizeof(RangeTask) <=
+                    executors::detail::TaskPool::kMaxBlockSize);
+
+      void* memory = executors::detail::TaskPool::Allocate(sizeof(RangeTask));
+      return new (memory) RangeTask(loop, begin, end);
+    }
+
+    void Run() noexcept override {
+      Loop* loop = loop_;
+      const size_t begin = begin_;
+      const size_t end = end_;
+
+      this->~RangeTask();
+      executors::detail::TaskPool::Release(this, sizeof(RangeTask));
+
+      {
+        // lets a nested call suspend the carrier fiber
+        satellite::MetaData old =
+            satellite::SetContext(&loop->pool_, cancel::Never());
+
+        loop->Process(begin, end);
+
+        satellite::RestoreContext(std::move(old));
+      }
+
+      loop->Done();
+    }
+
+   private:
+    RangeTask(Loop* loop, size_t begin, size_t end)
+        : loop_(loop),
+          begin_(begin),
+          end_(end) {
+    }
+
+   private:
+    Loop* loop_;
+    size_t begin_;
+    size_t end_;
+  };
+
+ public:
+  Loop(Pool& pool, Body& body, size_t size, Grain grain)
+      : pool_(pool),
+        body_(body),
+        size_(size),
+        grain_(grain.elements),
+        tune_(grain.IsAuto()) {
+  }
+
+  // Non-copyable
+  Loop(const Loop&) = delete;
+  Loop& operator=(const Loop&) = delete;
+
+  void Run() {
+    if (size_ == 0) {
+      return;
+    }
+
+    executors::tp::fast::Worker* worker =
+        executors::tp::fast::Worker::Current();
+    const bool on_pool = worker != nullptr && &worker->Host() == &pool_;
+
+    if (on_pool && !fibers::IAmFiber()) {
+      // Thread runner: a blocked worker can not help, stay serial
+      body_(0, size_);
+      return;
+    }
+
+    if (on_pool) {
+      Process(0, size_);
+      Done();
+    } else {
+      pool_.Submit(RangeTask::Make(this, 0, size_),
+                   executors::SchedulerHint::UpToYou);
+    }
+
+    join_.Wait();
+  }
+
+ private:
+  void Process(size_t begin, size_t end) {
+    if (tune_) {
+      // only the root ever sees tune_ set
+      tune_ = false;
+      begin = Tune(begin, end);
+    }
+
+    while (end - begin > grain_) {
+      if (ShouldSplit()) {
+        const size_t middle = begin + (end - begin) / 2;
+        Fork(middle, end);
+        end = middle;
+      } else {
+        body_(begin, begin + grain_);
+        begin += grain_;
+      }
+    }
+
+    if (begin != end) {
+      body_(begin, end);
+    }
+  }
+
+  // Times exponentially growing chunks, returns new begin
+  size_t Tune(size_t begin, size_t end) {
+    using Clock = std::chrono::steady_clock;
+
+    const size_t max_grain = MaxGrain(pool_, size_);
+
+    size_t probe = 1;
+    size_t done = 0;
+    Clock::duration elapsed{0};
+
+    while (begin != end && done < max_grain && elapsed < kProbeTime) {
+      const size_t chunk = std::min(probe, end - begin);
+
+      const auto start = Clock::now();
+      body_(begin, begin + chunk);
+      elapsed += Clock::now() - start;
+
+      begin += chunk;
+      done += chunk;
+      probe *= 2;
+    }
+
+    if (elapsed.count() <= 0) {
+      grain_ = max_grain;
+    } else {
+      const auto per_chunk =
+          std::chrono::duration_cast<Clock::duration>(kTargetChunkTime);
+      const double grain =
+          static_cast<double>(done) * per_chunk.count() / elapsed.count();
+      grain_ = std::clamp<size_t>(static_cast<size_t>(grain), 1, max_grain);
+    }
+
+    return begin;
+  }
+
+  static bool ShouldSplit() {
+    return executors::tp::fast::Worker::Current()->LocalQueueSize() == 0;
+  }
+
+  void Fork(size_t begin, size_t end) {
+    pending_.fetch_add(1, std::memory_order::relaxed);
+
+    pool_.Submit(RangeTask::Make(this, begin, end),
+                 executors::SchedulerHint::UpToYou);
+  }
+
+  void Done() {
+    // acq_rel: the last one publishes every chunk to the waiter
+    if (pending_.fetch_sub(1, std::memory_order::acq_rel) == 1) {
+      join_.Fire();
+    }
+  }
+
+ private:
+  Pool& pool_;
+  Body& body_;
+  const size_t size_;
+
+  size_t grain_;
+  bool tune_;
+
+  twist::ed::stdlike::atomic<size_t> pending_{1};
+  Join join_;
+};
+
+// Blocks until body has covered [0, size)
+template <typename Body>
+void ParallelFor(Pool& pool, size_t size, Grain grain, Body body) {
+  Loop<Body> loop{pool, body, size, grain};
+  loop.Run();
+}
+
+}  // namespace detail
+
+}  // namespace weave::parallel
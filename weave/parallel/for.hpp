@@ -0,0 +1,59 @@
+#pragma once
+
+#include <weave/parallel/grain.hpp>
+
+#include <weave/parallel/detail/loop.hpp>
+
+#include <concepts>
+#include <cstdlib>
+#include <iterator>
+#include <ranges>
+
+namespace weave::parallel {
+
+/*
+ * Usage:
+ *
+ * parallel::For(pool, 0, n, [&](size_t i) {
+ *   squares[i] = i * i;
+ * });
+ *
+ * parallel::For(pool, values, [](int& value) {
+ *   ++value;
+ * });
+ *
+ * Blocks until every call is done. Calls from a fiber of the pool
+ * run a share of the work and suspend instead of blocking the worker
+ *
+ */
+
+// fun(i) for every i in [from, to)
+template <std::integral Index, typename F>
+void For(Pool& pool, Index from, Index to, F fun, Grain grain = {}) {
+  if (to <= from) {
+    return;
+  }
+
+  const size_t size = static_cast<size_t>(to - from);
+
+  detail::ParallelFor(pool, size, grain, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      fun(static_cast<Index>(from + static_cast<Index>(i)));
+    }
+  });
+}
+
+// fun(element) for every element of range
+template <std::ranges::random_access_range Range, typename F>
+void For(Pool& pool, Range&& range, F fun, Grain grain = {}) {
+  auto first = std::ranges::begin(range);
+  const size_t size = std::ranges::size(range);
+
+  detail::ParallelFor(pool, size, grain, [&](size_t begin, size_t end) {
+    for (auto it = first + begin; it != first + end; ++it) {
+      fun(*it);
+    }
+  });
+}
+
+}  // namespace weave::parallel
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdlib>
+
+namespace weave::parallel {
+
+// Smallest chunk of elements processed without checking for thieves
+//
+// Zero means auto: the first chunks are timed and the grain is picked
+// so that a chunk takes about 20us, which amortizes
+// the cost of a fork without hurting the balance
+
+struct Grain {
+  size_t elements = 0;
+
+  bool IsAuto() const {
+    return elements == 0;
+  }
+};
+
+}  // namespace weave::parallel
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <weave/parallel/grain.hpp>
+
+#include <weave/parallel/detail/loop.hpp>
+
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <ranges>
+#include <utility>
+
+namespace weave::parallel {
+
+/*
+ * Usage:
+ *
+ * int64_t sum = parallel::Reduce(pool, values, int64_t{0});
+ *
+ * int max = parallel::Reduce(pool, values, INT_MIN, [](int a, int b) {
+ *   return std::max(a, b);
+ * });
+ *
+ */
+
+// Like std::reduce: op must be associative and commutative,
+// chunks are combined in no particular order
+template <std::ranges::random_access_range Range, typename T,
+          typename Op = std::plus<>>
+T Reduce(Pool& pool, Range&& range, T init, Op op = {}, Grain grain = {}) {
+  auto first = std::ranges::begin(range);
+  const size_t size = std::ranges::size(range);
+
+  T result = std::move(init);
+  threads::blocking::SpinLock mutex;
+
+  detail::ParallelFor(pool, size, grain, [&](size_t begin, size_t end) {
+    T partial = first[begin];
+    for (size_t i = begin + 1; i < end; ++i) {
+      partial = op(std::move(partial), first[i]);
+    }
+
+    // once per chunk
+    std::lock_guard guard{mutex};
+    result = op(std::move(result), std::move(partial));
+  });
+
+  return result;
+}
+
+}  // namespace weave::parallel
@@ -0,0 +1,95 @@
+#pragma once
+
+#include <weave/parallel/grain.hpp>
+
+#include <weave/parallel/detail/loop.hpp>
+
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace weave::parallel {
+
+/*
+ * Usage:
+ *
+ * std::vector<int64_t> prefix(values.size());
+ *
+ * parallel::Scan(pool, values, prefix.begin(), int64_t{0});
+ *
+ * // prefix[i] = values[0] + ... + values[i]
+ *
+ */
+
+// Inclusive scan: out[i] = init op range[0] op ... op range[i]
+// op must be associative
+//
+// Two passes over blocks: block sums in parallel, a serial scan over them,
+// then every block is scanned from its offset in parallel. Does twice
+// as many op calls as the serial scan
+template <std::ranges::random_access_range Range,
+          std::random_access_iterator Out, typename T,
+          typename Op = std::plus<>>
+Out Scan(Pool& pool, Range&& range, Out out, T init, Op op = {}) {
+  auto first = std::ranges::begin(range);
+  const size_t size = std::ranges::size(range);
+
+  if (size == 0) {
+    return out;
+  }
+
+  // a few blocks per worker
+  const size_t block_size = detail::MaxGrain(pool, size);
+  const size_t blocks = (size + block_size - 1) / block_size;
+
+  auto block_end = [&](size_t block) {
+    return std::min(size, (block + 1) * block_size);
+  };
+
+  // sums[block] = op over the block, the last one is never needed
+  std::vector<T> sums(blocks, init);
+
+  if (blocks > 1) {
+    detail::ParallelFor(pool, blocks - 1, {.elements = 1},
+                        [&](size_t begin, size_t end) {
+                          for (size_t block = begin; block < end; ++block) {
+                            const size_t from = block * block_size;
+
+                            T sum = first[from];
+                            for (size_t i = from + 1; i < block_end(block);
+                                 ++i) {
+                              sum = op(std::move(sum), first[i]);
+                            }
+                            sums[block] = std::move(sum);
+                          }
+                        });
+  }
+
+  // sums[block] = offset of the block, serial
+  T offset = std::move(init);
+  for (size_t block = 0; block < blocks; ++block) {
+    T next = block + 1 < blocks ? op(offset, sums[block]) : offset;
+    sums[block] = std::move(offset);
+    offset = std::move(next);
+  }
+
+  detail::ParallelFor(pool, blocks, {.elements = 1},
+                      [&](size_t begin, size_t end) {
+                        for (size_t block = begin; block < end; ++block) {
+                          T running = sums[block];
+                          for (size_t i = block * block_size;
+                               i < block_end(block); ++i) {
+                            running = op(std::move(running), first[i]);
+                            out[i] = running;
+                          }
+                        }
+                      });
+
+  return out + size;
+}
+
+}  // namespace weave::parallel
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <weave/parallel/detail/loop.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <ranges>
+#include <utility>
+#include <vector>
+
+namespace weave::parallel {
+
+namespace detail {
+
+// Below that Sort is just std::sort
+inline const size_t kSerialSortThreshold = 1 << 14;
+
+// How many elements of `a` the stable merge of `a` and `b`
+// puts into its first `k` outputs
+template <typename It, typename Compare>
+size_t CoRank(size_t k, It a, size_t a_size, It b, size_t b_size,
+              Compare& comp) {
+  size_t low = k > b_size ? k - b_size : 0;
+  size_t high = std::min(k, a_size);
+
+  while (low < high) {
+    const size_t i = low + (high - low) / 2;
+    // ties go to `a`
+    if (!comp(b[k - i - 1], a[i])) {
+      low = i + 1;
+    } else {
+      high = i;
+    }
+  }
+
+  return low;
+}
+
+// Merges sorted runs of `width` pairwise from src to dst,
+// splits the output into even parts regardless of run boundaries
+//
+// Merges move elements out of src, so split points are found
+// by a separate read-only pass
+template <typename It, typename Out, typename Compare>
+void MergeRuns(Pool& pool, It src, Out dst, size_t size, size_t width,
+               Compare& comp) {
+  const size_t part = MaxGrain(pool, size);
+  const size_t parts = (size + part - 1) / part;
+
+  struct Run {
+    size_t low;
+    size_t middle;
+    size_t high;
+  };
+
+  auto run_of = [&](size_t position) {
+    const size_t low = position - position % (2 * width);
+    return Run{low, std::min(low + width, size),
+               std::min(low + 2 * width, size)};
+  };
+
+  // ranks[p]: elements of the left run before part p starts
+  std::vector<size_t> ranks(parts);
+
+  ParallelFor(pool, parts, {.elements = 1}, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; ++p) {
+      const Run run = run_of(p * part);
+      ranks[p] = CoRank(p * part - run.low, src + run.low,
+                        run.middle - run.low, src + run.middle,
+                        run.high - run.middle, comp);
+    }
+  });
+
+  ParallelFor(pool, parts, {.elements = 1}, [&](size_t begin, size_t end) {
+    for (size_t p = begin; p < end; ++p) {
+      size_t from = p * part;
+      const size_t to = std::min(size, from + part);
+
+      size_t a_from = ranks[p];
+
+      while (from < to) {
+        const Run run = run_of(from);
+        const size_t until = std::min(to, run.high);
+
+        const size_t a_to = until == run.high ? run.middle - run.low
+                                              : ranks[p + 1];
+        const size_t b_from = from - run.low - a_from;
+        const size_t b_to = until - run.low - a_to;
+
+        It a = src + run.low;
+        It b = src + run.middle;
+
+        std::merge(std::make_move_iterator(a + a_from),
+                   std::make_move_iterator(a + a_to),
+                   std::make_move_iterator(b + b_from),
+                   std::make_move_iterator(b + b_to), dst + from, comp);
+
+        // next piece starts a run
+        from = until;
+        a_from = 0;
+      }
+    }
+  });
+}
+
+}  // namespace detail
+
+/*
+ * Usage:
+ *
+ * parallel::Sort(pool, values);
+ *
+ * parallel::Sort(pool, values, std::greater<>{});
+ *
+ */
+
+// Not stable, value type must be default constructible
+//
+// Blocks are sorted with std::sort in parallel, then merged pairwise
+// through a buffer, every merge round is split evenly across the pool
+template <std::ranges::random_access_range Range,
+          typename Compare = std::ranges::less>
+void Sort(Pool& pool, Range&& range, Compare comp = {}) {
+  using T = std::ranges::range_value_t<Range>;
+
+  auto first = std::ranges::begin(range);
+  const size_t size = std::ranges::size(range);
+
+  if (size <= detail::kSerialSortThreshold) {
+    std::sort(first, first + size, comp);
+    return;
+  }
+
+  // power of two blocks, a few per worker
+  const size_t blocks = std::min(
+      std::bit_ceil(size / detail::MaxGrain(pool, size)),
+      std::bit_ceil(size / detail::kSerialSortThreshold));
+  const size_t width = (size + blocks - 1) / blocks;
+
+  detail::ParallelFor(pool, blocks, {.elements = 1},
+                      [&](size_t begin, size_t end) {
+                        for (size_t block = begin; block < end; ++block) {
+                          const size_t from = std::min(size, block * width);
+                          const size_t to = std::min(size, from + width);
+                          std::sort(first + from, first + to, comp);
+                        }
+                      });
+
+  if (blocks == 1) {
+    return;
+  }
+
+  std::vector<T> buffer(size);
+  bool in_buffer = false;
+
+  for (size_t run = width; run < size; run *= 2) {
+    if (in_buffer) {
+      detail::MergeRuns(pool, buffer.begin(), first, size, run, comp);
+    } else {
+      detail::MergeRuns(pool, first, buffer.begin(), size, run, comp);
+    }
+    in_buffer = !in_buffer;
+  }
+
+  if (in_buffer) {
+    detail::ParallelFor(pool, size, {}, [&](size_t begin, size_t end) {
+      std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+    });
+  }
+}
+
+}  // namespace weave::parallel
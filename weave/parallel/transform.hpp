@@ -0,0 +1,40 @@
+#pragma once
+
+#include <weave/parallel/grain.hpp>
+
+#include <weave/parallel/detail/loop.hpp>
+
+#include <cstdlib>
+#include <iterator>
+#include <ranges>
+
+namespace weave::parallel {
+
+/*
+ * Usage:
+ *
+ * std::vector<double> roots(values.size());
+ *
+ * parallel::Transform(pool, values, roots.begin(), [](double value) {
+ *   return std::sqrt(value);
+ * });
+ *
+ */
+
+// out[i] = fun(range[i]), returns the end of the output
+template <std::ranges::random_access_range Range,
+          std::random_access_iterator Out, typename F>
+Out Transform(Pool& pool, Range&& range, Out out, F fun, Grain grain = {}) {
+  auto first = std::ranges::begin(range);
+  const size_t size = std::ranges::size(range);
+
+  detail::ParallelFor(pool, size, grain, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      out[i] = fun(first[i]);
+    }
+  });
+
+  return out + size;
+}
+
+}  // namespace weave::parallel
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+
+namespace weave::satellite {
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Counters of a single logger shard
+// Padded to whole cache lines, so shards of different workers never
+// share one. Always atomic, readers take snapshots while writers run.
+// A single writer updates them with plain load + store, no RMW
+
+template <bool SharedShards>
+class Counters {
+  using Counter = twist::ed::stdlike::atomic<size_t>;
+
+  static constexpr size_t kPerLine = std::max<size_t>(1, 64 / sizeof(Counter));
+
+  struct alignas(64) Line {
+    std::array<Counter, kPerLine> counters{};
+  };
+
+ public:
+  explicit Counters(size_t count)
+      : count_(count),
+        lines_(std::make_unique<Line[]>((count + kPerLine - 1) / kPerLine)) {
+  }
+
+  void Add(size_t index, size_t diff) {
+    Counter& counter = At(index);
+
+    if constexpr (SharedShards) {
+      counter.fetch_add(diff, std::memory_order::relaxed);
+    } else {
+      counter.store(counter.load(std::memory_order::relaxed) + diff,
+                    std::memory_order::relaxed);
+    }
+  }
+
+  size_t Load(size_t index) const {
+    return At(index).load(std::memory_order::relaxed);
+  }
+
+  size_t Size() const {
+    return count_;
+  }
+
+ private:
+  Counter& At(size_t index) const {
+    return lines_[index / kPerLine].counters[index % kPerLine];
+  }
+
+ private:
+  const size_t count_;
+  std::unique_ptr<Line[]> lines_;
+};
+
+}  // namespace weave::satellite
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <string_view>
+
+namespace weave::satellite {
+
+/////////////////////////////////////////////////////////////////////////////
+
+// HDR-style log-bucketed histogram: every power of two is split into
+// kSubBuckets linear buckets, so a value is known up to 1/kSubBuckets of it
+
+class Histogram {
+ public:
+  static constexpr size_t kSubBucketBits = 3;
+  static constexpr size_t kSubBuckets = 1 << kSubBucketBits;
+  static constexpr size_t kBuckets = (64 - kSubBucketBits + 1) * kSubBuckets;
+
+  static size_t BucketOf(uint64_t value) {
+    const size_t width = std::bit_width(value);
+    const size_t shift =
+        std::max(width, kSubBucketBits + 1) - (kSubBucketBits + 1);
+
+    return (shift << kSubBucketBits) + (value >> shift);
+  }
+
+  // Highest value which falls into `bucket`
+  static uint64_t UpperBound(size_t bucket) {
+    const size_t shift =
+        bucket < 2 * kSubBuckets ? 0 : (bucket >> kSubBucketBits) - 1;
+    const uint64_t top = bucket - (shift << kSubBucketBits);
+
+    return (top << shift) + ((uint64_t{1} << shift) - 1);
+  }
+
+  void Add(size_t bucket, uint64_t count) {
+    counts_[bucket] += count;
+    total_ += count;
+  }
+
+  Histogram& operator+=(const Histogram& that) {
+    for (size_t i = 0; i < kBuckets; ++i) {
+      counts_[i] += that.counts_[i];
+    }
+    total_ += that.total_;
+
+    return *this;
+  }
+
+  uint64_t Count() const {
+    return total_;
+  }
+
+  // `percentile` in [0, 100], 0 for an empty histogram
+  uint64_t Percentile(double percentile) const {
+    if (total_ == 0) {
+      return 0;
+    }
+
+    const auto rank = std::max<uint64_t>(
+        1, static_cast<uint64_t>(percentile / 100 * total_ + 0.5));
+
+    uint64_t seen = 0;
+
+    for (size_t i = 0; i < kBuckets; ++i) {
+      seen += counts_[i];
+
+      if (seen >= rank) {
+        return UpperBound(i);
+      }
+    }
+
+    return Max();
+  }
+
+  uint64_t Max() const {
+    for (size_t i = kBuckets; i > 0; --i) {
+      if (counts_[i - 1] != 0) {
+        return UpperBound(i - 1);
+      }
+    }
+
+    return 0;
+  }
+
+  void Print(std::string_view name) const {
+    fmt::println("{}: count {}, p50 {}, p99 {}, p99.9 {}, max {}", name,
+                 Count(), Percentile(50), Percentile(99), Percentile(99.9),
+                 Max());
+  }
+
+ private:
+  std::array<uint64_t, kBuckets> counts_{};
+  uint64_t total_{0};
+};
+
+/////////////////////////////////////////////////////////////////////////////
+
+// Single writer, any number of concurrent readers
+// Fills whole cache lines, recorders of different writers never share one
+
+class alignas(64) HistogramRecorder {
+ public:
+  void Record(uint64_t value) {
+    auto& bucket = counts_[Histogram::BucketOf(value)];
+
+    // no RMW: only the owner writes
+    bucket.store(bucket.load(std::memory_order::relaxed) + 1,
+                 std::memory_order::relaxed);
+  }
+
+  // Safe while the writer is running, buckets are eventually consistent
+  void AddTo(Histogram& target) const {
+    for (size_t i = 0; i < Histogram::kBuckets; ++i) {
+      if (uint64_t count = counts_[i].load(std::memory_order::relaxed)) {
+        target.Add(i, count);
+      }
+    }
+  }
+
+ private:
+  std::array<twist::ed::stdlike::atomic<uint64_t>, Histogram::kBuckets>
+      counts_{};
+};
+
+}  // namespace weave::satellite
@@ -2,13 +2,16 @@
 
 #include <weave/result/types/unit.hpp>
 
-#include <weave/threads/lockfree/atomic_array.hpp>
+#include <weave/satellite/counters.hpp>
+#include <weave/satellite/histogram.hpp>
 
 #include <fmt/core.h>
 
 #include <wheels/core/assert.hpp>
 
+#include <memory>
 #include <optional>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -16,13 +19,20 @@ namespace weave::satellite {
 
 /////////////////////////////////////////////////////////////////////////////
 
-template <bool CollectMetrics, bool AtomicMetrics>
+// Metrics are addressed either by name or by a compile-time id:
+// an enum whose values are positions of the names passed to the Logger.
+// Ids skip the hash lookup and are meant for hot paths
+//
+// SharedShards: several threads may write to one shard at the same time
+
+template <bool CollectMetrics, bool SharedShards>
 class Logger {
  public:
   class LoggerShard;
   class Metrics;
 
-  explicit Logger(const std::vector<std::string>&, size_t) {
+  explicit Logger(const std::vector<std::string>&, size_t,
+                  const std::vector<std::string>& = {}) {
   }
 
   Logger(const Logger&) = delete;
@@ -35,6 +45,10 @@ class Logger {
     return Metrics();
   }
 
+  Unit GatherHistograms() {
+    return {};
+  }
+
   LoggerShard* MakeShard(size_t) {
     return &singleton;
   }
@@ -47,6 +61,19 @@ class Logger {
     void Increment(std::string_view, size_t) {
     }
 
+    template <typename Id>
+    requires std::is_enum_v<Id>
+    void Increment(Id, size_t) {
+    }
+
+    void Record(std::string_view, uint64_t) {
+    }
+
+    template <typename Id>
+    requires std::is_enum_v<Id>
+    void Record(Id, uint64_t) {
+    }
+
     LoggerShard& operator+=(const LoggerShard&) {
       return *this;
     }
@@ -68,14 +95,18 @@ class Logger {
     Unit Data() && {
       return {};
     }
+
+    Unit Histograms() && {
+      return {};
+    }
   };
 
  private:
   static inline LoggerShard singleton{};
 };
 
-template <bool AtomicMetrics>
-class Logger<true, AtomicMetrics> {
+template <bool SharedShards>
+class Logger<true, SharedShards> {
  public:
   class LoggerShard;
   class Metrics;
@@ -85,14 +116,21 @@ class Logger<true, AtomicMetrics> {
 
   Logger() = delete;
 
-  explicit Logger(const std::vector<std::string>& names, size_t num_shards)
-      : shards_(num_shards, std::nullopt),
-        total_(this, names.size()) {
+  // `histograms` are recorded via LoggerShard::Record
+  explicit Logger(const std::vector<std::string>& names, size_t num_shards,
+                  const std::vector<std::string>& histograms = {})
+      : names_(names),
+        histogram_names_(histograms),
+        shards_(num_shards, std::nullopt) {
     const size_t size = names.size();
 
     for (size_t i = 0; i < size; ++i) {
       indices_[names[i]] = i;
     }
+
+    for (size_t i = 0; i < histograms.size(); ++i) {
+      histogram_indices_[histograms[i]] = i;
+    }
   }
 
   Logger(const Logger&) = delete;
@@ -101,36 +139,55 @@ class Logger<true, AtomicMetrics> {
   Logger(Logger&&) = delete;
   Logger& operator=(Logger&&) = delete;
 
+  // Lock-free, safe without stopping the writers
+  // Every counter is exact, counters may be taken at slightly
+  // different moments
   Metrics GatherMetrics() {
-    Accumulate();
+    std::vector<size_t> totals(names_.size(), 0);
 
-    return total_.GetMetrics();
-  }
+    for (auto& shard : shards_) {
+      if (!shard.has_value()) {
+        continue;
+      }
 
-  LoggerShard* MakeShard(size_t index) {
-    shards_[index].emplace(this);
+      for (size_t i = 0; i < totals.size(); ++i) {
+        totals[i] += shard->LookUp(i);
+      }
+    }
 
-    return &*shards_[index];
+    return Metrics(*this, totals);
   }
 
- private:
-  void Accumulate() {
-    const size_t size = total_.metrics_.Size();
+  // Recorders are atomic, safe without stopping the writers
+  std::vector<std::pair<std::string, Histogram>> GatherHistograms() {
+    std::vector<std::pair<std::string, Histogram>> histograms;
 
-    for (size_t i = 0; i < size; ++i) {
-      total_.metrics_.Store(i, 0, std::memory_order::relaxed);
-    }
+    for (size_t index = 0; index < histogram_names_.size(); ++index) {
+      Histogram merged;
 
-    for (auto& shard : shards_) {
-      total_ += *shard;
+      for (auto& shard : shards_) {
+        if (shard.has_value()) {
+          shard->histograms_[index].AddTo(merged);
+        }
+      }
+
+      histograms.emplace_back(histogram_names_[index], merged);
     }
+
+    return histograms;
+  }
+
+  LoggerShard* MakeShard(size_t index) {
+    shards_[index].emplace(this);
+
+    return &*shards_[index];
   }
 
  public:
   /////////////////////////////////////////////////////////////////////////////
 
   class LoggerShard {
-    using Owner = Logger<true, AtomicMetrics>;
+    using Owner = Logger<true, SharedShards>;
 
     template <bool A, bool B>
     friend class Logger;
@@ -152,7 +209,9 @@ class Logger<true, AtomicMetrics> {
 
     explicit LoggerShard(Owner* owner)
         : owner_(owner),
-          metrics_(owner_->indices_.size()) {
+          metrics_(owner_->names_.size()),
+          histograms_(std::make_unique<HistogramRecorder[]>(
+              owner_->histogram_names_.size())) {
     }
 
     void Increment(std::string_view name, size_t diff) {
@@ -165,7 +224,36 @@ class Logger<true, AtomicMetrics> {
       // but find does. Treat this line as owner_->indices_[name]
       size_t index = pos->second;
 
-      metrics_.FetchAdd(index, diff, std::memory_order::relaxed);
+      metrics_.Add(index, diff);
+    }
+
+    template <typename Id>
+    requires std::is_enum_v<Id>
+    void Increment(Id id, size_t diff) {
+      WHEELS_ASSERT(static_cast<size_t>(id) < metrics_.Size(),
+                    "Unknown metric id");
+
+      metrics_.Add(static_cast<size_t>(id), diff);
+    }
+
+    // Single writer per shard
+    void Record(std::string_view name, uint64_t value) {
+      auto pos = owner_->histogram_indices_.find(name);
+
+      WHEELS_VERIFY(pos != owner_->histogram_indices_.end(),
+                    "You must use a valid histogram name!");
+
+      histograms_[pos->second].Record(value);
+    }
+
+    template <typename Id>
+    requires std::is_enum_v<Id>
+    void Record(Id id, uint64_t value) {
+      WHEELS_ASSERT(
+          static_cast<size_t>(id) < owner_->histogram_names_.size(),
+          "Unknown histogram id");
+
+      histograms_[static_cast<size_t>(id)].Record(value);
     }
 
     LoggerShard& operator+=(LoggerShard& that) {
@@ -174,35 +262,27 @@ class Logger<true, AtomicMetrics> {
       const size_t size = metrics_.Size();
 
       for (size_t i = 0; i < size; ++i) {
-        metrics_.FetchAdd(i, that.LookUp(i), std::memory_order::relaxed);
+        metrics_.Add(i, that.LookUp(i));
       }
 
       return *this;
     }
 
    private:
-    // One consumer
-    Metrics GetMetrics() {
-      return Metrics(*this);
-    }
-
     size_t LookUp(size_t index) {
-      return metrics_.Load(index, std::memory_order::relaxed);
-    }
-
-    LoggerShard(Owner* owner, size_t count)
-        : owner_(owner),
-          metrics_(count) {
+      return metrics_.Load(index);
     }
 
    private:
     Owner* owner_;
-    threads::lockfree::MaybeAtomicArray<size_t, AtomicMetrics> metrics_;
+    Counters<SharedShards> metrics_;
+    std::unique_ptr<HistogramRecorder[]> histograms_;
   };
 
   /////////////////////////////////////////////////////////////////////////////
 
   class Metrics {
+    friend class Logger;
     friend class LoggerShard;
 
    public:
@@ -218,21 +298,31 @@ class Logger<true, AtomicMetrics> {
       for (auto [name, count] : data_) {
         fmt::println("{}: {}", name, count);
       }
+
+      for (const auto& [name, histogram] : histograms_) {
+        histogram.Print(name);
+      }
     }
 
     auto Data() && {
       return std::move(data_);
     }
 
+    auto Histograms() && {
+      return std::move(histograms_);
+    }
+
    private:
-    explicit Metrics(LoggerShard& source) {
-      for (auto [name, index] : source.owner_->indices_) {
-        data_.emplace_back(name, source.LookUp(index));
+    Metrics(Logger& owner, const std::vector<size_t>& totals)
+        : histograms_(owner.GatherHistograms()) {
+      for (size_t i = 0; i < totals.size(); ++i) {
+        data_.emplace_back(owner.names_[i], totals[i]);
       }
     }
 
    private:
     std::vector<std::pair<std::string, size_t>> data_{};
+    std::vector<std::pair<std::string, Histogram>> histograms_{};
   };
 
  private:
@@ -253,10 +343,15 @@ class Logger<true, AtomicMetrics> {
     }
   };
 
+  // positions are compile-time ids
+  const std::vector<std::string> names_;
+  const std::vector<std::string> histogram_names_;
+
   std::unordered_map<std::string, size_t, StringHash, std::equal_to<>>
       indices_{};
+  std::unordered_map<std::string, size_t, StringHash, std::equal_to<>>
+      histogram_indices_{};
   std::vector<std::optional<LoggerShard>> shards_;
-  LoggerShard total_;
 };
 
-}  // namespace weave::satellite
\ No newline at end of file
+}  // namespace weave::satellite
@@ -1,6 +1,8 @@
 #include <weave/satellite/satellite.hpp>
 #include <weave/satellite/meta_data.hpp>
 
+#include <weave/fibers/sched/yield.hpp>
+
 #include <weave/support/constructor_bases.hpp>
 
 #include <twist/ed/stdlike/atomic.hpp>
@@ -32,6 +34,8 @@ void PollToken() {
   if (runner != nullptr && runner->CancelToken().CancelRequested()) {
     throw cancel::CancelledException{};
   }
+
+  fibers::MaybeYield();
 }
 
 // Executor
@@ -22,6 +22,7 @@ void RestoreContext(MetaData);
 
 // Cancel Token
 
+// Also yields if the time slice of the running fiber is over
 void PollToken();
 
 // Executors
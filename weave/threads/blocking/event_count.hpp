@@ -0,0 +1,92 @@
+#pragma once
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/wait/futex.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace weave::threads::blocking {
+
+// Lets consumers sleep on a condition without a mutex,
+// notifications are free unless someone is about to sleep
+//
+// Consumer:
+//
+//   auto key = events.PrepareWait();
+//   if (condition holds) {
+//     events.CancelWait();
+//   } else {
+//     events.Wait(key);
+//   }
+//
+// Producer: make condition hold, then events.NotifyOne()
+
+class EventCount {
+ public:
+  using Key = uint32_t;
+
+  Key PrepareWait() {
+    waiters_.fetch_add(1, std::memory_order::seq_cst);
+    // pairs with the fence in Notify*: either we see the condition
+    // or the producer sees us
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    return epoch_.load(std::memory_order::acquire);
+  }
+
+  void CancelWait() {
+    waiters_.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+  // Returns once epoch has moved past key, may return spuriously
+  void Wait(Key key) {
+    twist::ed::futex::Wait(epoch_, key, std::memory_order::acquire);
+    waiters_.fetch_sub(1, std::memory_order::relaxed);
+  }
+
+  void NotifyOne() {
+    if (HasWaiters()) {
+      auto wake_key = twist::ed::futex::PrepareWake(epoch_);
+      epoch_.fetch_add(1, std::memory_order::release);
+      twist::ed::futex::WakeOne(wake_key);
+    }
+  }
+
+  // Wakes up to `count` waiters
+  void NotifyMany(size_t count) {
+    if (count == 0 || !HasWaiters()) {
+      return;
+    }
+
+    auto wake_key = twist::ed::futex::PrepareWake(epoch_);
+    epoch_.fetch_add(1, std::memory_order::release);
+
+    const size_t waiters = waiters_.load(std::memory_order::relaxed);
+    for (size_t i = 0; i < std::min<size_t>(count, waiters); ++i) {
+      twist::ed::futex::WakeOne(wake_key);
+    }
+  }
+
+  void NotifyAll() {
+    if (HasWaiters()) {
+      auto wake_key = twist::ed::futex::PrepareWake(epoch_);
+      epoch_.fetch_add(1, std::memory_order::release);
+      twist::ed::futex::WakeAll(wake_key);
+    }
+  }
+
+ private:
+  bool HasWaiters() {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    return waiters_.load(std::memory_order::relaxed) != 0;
+  }
+
+ private:
+  // Consumers between PrepareWait and the end of Wait/CancelWait
+  twist::ed::stdlike::atomic<uint32_t> waiters_{0};
+  // Futex word, bumped by every notification which may wake someone
+  twist::ed::stdlike::atomic<uint32_t> epoch_{0};
+};
+
+}  // namespace weave::threads::blocking
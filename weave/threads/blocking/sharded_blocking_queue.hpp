@@ -0,0 +1,171 @@
+#pragma once
+
+#include <weave/threads/blocking/event_count.hpp>
+#include <weave/threads/blocking/spinlock.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+#include <cstdlib>
+#include <deque>
+#include <mutex>
+
+namespace weave::threads::blocking {
+
+// Unbounded blocking MPMC queue split into shards
+//
+// Producers and consumers name a shard, usually their own:
+// a consumer drains its shard first and then takes from the others,
+// so uncontended operations touch a single shard lock.
+// Sleeping goes through EventCount: Put wakes someone
+// only if a consumer is actually about to sleep
+
+template <typename T>
+class ShardedBlockingQueue {
+  struct alignas(64) Shard {
+    SpinLock mutex;
+    wheels::IntrusiveList<T> items;  // guarded by mutex
+    // Lets consumers skip empty shards without locking
+    twist::ed::stdlike::atomic<size_t> size{0};
+  };
+
+ public:
+  explicit ShardedBlockingQueue(size_t shards)
+      : shards_(std::max<size_t>(shards, 1)) {
+  }
+
+  size_t ShardCount() const {
+    return shards_.size();
+  }
+
+  // returns false if queue was closed
+  bool Put(T* object, size_t shard) {
+    if (closed_.load(std::memory_order::relaxed)) {
+      return false;
+    }
+
+    {
+      Shard& target = shards_[shard % shards_.size()];
+      std::lock_guard guard{target.mutex};
+      target.items.PushBack(object);
+      target.size.store(target.size.load(std::memory_order::relaxed) + 1,
+                        std::memory_order::relaxed);
+    }
+
+    events_.NotifyOne();
+    return true;
+  }
+
+  // appends all objects to a single shard, leaves `objects` empty
+  // returns false if queue was closed
+  bool PutMany(wheels::IntrusiveList<T>& objects, size_t shard) {
+    if (closed_.load(std::memory_order::relaxed)) {
+      return false;
+    }
+
+    const size_t count = objects.Size();
+    if (count == 0) {
+      return true;
+    }
+
+    {
+      Shard& target = shards_[shard % shards_.size()];
+      std::lock_guard guard{target.mutex};
+      target.items.Append(objects);
+      target.size.store(target.size.load(std::memory_order::relaxed) + count,
+                        std::memory_order::relaxed);
+    }
+
+    events_.NotifyMany(count);
+    return true;
+  }
+
+  // returns nullptr iff the queue is closed and empty
+  T* Take(size_t shard) {
+    while (true) {
+      if (T* object = TryTake(shard)) {
+        return object;
+      }
+
+      const auto key = events_.PrepareWait();
+
+      if (T* object = TryTake(shard)) {
+        events_.CancelWait();
+        return object;
+      }
+
+      if (closed_.load(std::memory_order::acquire)) {
+        events_.CancelWait();
+        return nullptr;
+      }
+
+      events_.Wait(key);
+    }
+  }
+
+  // objects put before Close are still handed out
+  void Close() {
+    closed_.store(true, std::memory_order::release);
+    events_.NotifyAll();
+  }
+
+ private:
+  // own shard first, then the rest in order,
+  // on the first pass other shards are skipped if locked
+  T* TryTake(size_t shard) {
+    const size_t count = shards_.size();
+
+    for (size_t i = 0; i < count; ++i) {
+      Shard& victim = shards_[(shard + i) % count];
+
+      if (victim.size.load(std::memory_order::relaxed) == 0) {
+        continue;
+      }
+
+      if (T* object = TryPop(victim, /*wait_for_lock=*/i == 0)) {
+        return object;
+      }
+    }
+
+    // contended shards were skipped, look again before sleeping
+    for (size_t i = 0; i < count; ++i) {
+      Shard& victim = shards_[(shard + i) % count];
+
+      if (victim.size.load(std::memory_order::relaxed) == 0) {
+        continue;
+      }
+
+      if (T* object = TryPop(victim, /*wait_for_lock=*/true)) {
+        return object;
+      }
+    }
+
+    return nullptr;
+  }
+
+  // Gives up on a locked shard unless told to wait
+  T* TryPop(Shard& victim, bool wait_for_lock) {
+    std::unique_lock lock{victim.mutex, std::defer_lock};
+
+    if (wait_for_lock) {
+      lock.lock();
+    } else if (!lock.try_lock()) {
+      return nullptr;
+    }
+
+    T* object = victim.items.PopFront();
+    if (object != nullptr) {
+      victim.size.store(victim.size.load(std::memory_order::relaxed) - 1,
+                        std::memory_order::relaxed);
+    }
+    return object;
+  }
+
+ private:
+  std::deque<Shard> shards_;
+  twist::ed::stdlike::atomic<bool> closed_{false};
+  EventCount events_;
+};
+
+}  // namespace weave::threads::blocking
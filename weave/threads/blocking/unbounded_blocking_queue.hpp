@@ -28,6 +28,26 @@ class UnboundedBlockingQueue {
     return is_open_;
   }
 
+  // puts all objects from `objects` under a single lock acquisition
+  // returns false if queue was closed
+  bool PutMany(wheels::IntrusiveList<T>& objects) {
+    std::lock_guard lock(mutex_);
+
+    if (is_open_ && objects.NonEmpty()) {
+      const bool single = objects.Size() == 1;
+
+      queue_.Append(objects);
+
+      if (single) {
+        queue_is_not_empty_.NotifyOne();
+      } else {
+        queue_is_not_empty_.NotifyAll();
+      }
+    }
+
+    return is_open_;
+  }
+
   // returns nullptr iff the queue is empty
   T* Take() {
     std::unique_lock lock(mutex_);
@@ -14,7 +14,8 @@ struct IProcessor {
 
   virtual void AddTimer(TimerBase*) = 0;
 
-  virtual void NotifyProcessor() = 0;
+  // Timer was cancelled and can be fired early
+  virtual void NotifyProcessor(TimerBase*) = 0;
 
   Delay DelayFromThis(Millis ms) {
     return Delay{ms, *this};
@@ -30,8 +30,9 @@ class TimersQueue {
     PushToStack(timer);
   }
 
-  void PostCancelRequest() {
-    // Not Implemented :(
+  void PostCancelRequest(TimerBase*) {
+    // Cancelled timers are swept out of the heap
+    // by the next GrabReadyTimers call
   }
 
   std::pair<wheels::IntrusiveList<TimerBase>, std::optional<Millis>> GrabReadyTimers() {
@@ -0,0 +1,404 @@
+#pragma once
+
+#include <weave/timers/processor.hpp>
+#include <weave/timers/timer.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <wheels/intrusive/list.hpp>
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace weave::timers::detail {
+
+using namespace std::chrono_literals;
+
+// Hierarchical timing wheel (1ms ticks, 4 levels x 64 slots)
+// Push and PostCancelRequest are lock-free and can be called from any thread,
+// everything else must be called by a single consumer
+//
+// Insert is O(1), cancel unlinks timer from its slot in O(1)
+// Timers further than 64^4 ms (~4.6h) are parked at the top level
+// and re-examined every time they are cascaded
+
+class TimingWheel {
+ private:
+  using SteadyClock = std::chrono::steady_clock;
+  using TimePoint = SteadyClock::time_point;
+
+  using Slot = wheels::IntrusiveList<TimerBase>;
+
+  static constexpr size_t kLevels = 4;
+  static constexpr size_t kSlotBits = 6;
+  static constexpr size_t kSlots = 1 << kSlotBits;
+  static constexpr uint64_t kSlotMask = kSlots - 1;
+
+  static constexpr uint64_t kMaxDelta = (uint64_t)1 << (kSlotBits * kLevels);
+
+  // Consumer has seen the timer in
+  enum Sightings : uint32_t {
+    Incoming = 1,
+    CancelRequests = 2,
+  };
+
+ public:
+  TimingWheel()
+      : start_(SteadyClock::now()) {
+  }
+
+  // Any thread, returns the deadline of the timer:
+  // it can't be read back once the timer is published
+  TimePoint Push(TimerBase* timer) {
+    const TimePoint deadline = SteadyClock::now() + timer->GetDelay();
+    timer->deadline = deadline;
+
+    // reused timer (only timers which were not cancelled can be reused)
+    timer->state.fetch_and(~(uint32_t)TimerBase::Done,
+                           std::memory_order::relaxed);
+
+    TimerBase* curr_head = incoming_.load(std::memory_order::relaxed);
+
+    do {
+      timer->prev_ = curr_head;
+    } while (!incoming_.compare_exchange_weak(curr_head, timer,
+                                              std::memory_order::seq_cst,
+                                              std::memory_order::relaxed));
+
+    return deadline;
+  }
+
+  // Any thread, timer must be pushed before or concurrently with this call
+  void PostCancelRequest(TimerBase* timer) {
+    uint32_t prev = timer->state.fetch_or(TimerBase::Cancelled,
+                                          std::memory_order::acq_rel);
+
+    if ((prev & (TimerBase::Cancelled | TimerBase::Done)) != 0) {
+      // Either already fired or somebody else has notified
+      return;
+    }
+
+    TimerBase* curr_head = cancel_requests_.load(std::memory_order::relaxed);
+
+    do {
+      timer->next_cancelled = curr_head;
+    } while (!cancel_requests_.compare_exchange_weak(
+        curr_head, timer, std::memory_order::seq_cst,
+        std::memory_order::relaxed));
+  }
+
+  // Consumer
+  std::pair<wheels::IntrusiveList<TimerBase>, std::optional<Millis>>
+  GrabReadyTimers() {
+    auto now = SteadyClock::now();
+
+    UpdateQueueState();
+
+    // ticks that have fully elapsed
+    Advance(std::chrono::floor<Millis>(now - start_).count());
+
+    wheels::IntrusiveList<TimerBase> timers = std::move(ready_);
+
+    return std::make_pair(std::move(timers), UntilNext(now));
+  }
+
+  // Consumer, lower bound for the next deadline, nothing is fired
+  std::optional<Millis> UntilNextDeadline() {
+    UpdateQueueState();
+
+    if (ready_.NonEmpty()) {
+      return 0ms;
+    }
+
+    return UntilNext(SteadyClock::now());
+  }
+
+  // Any thread, there are pushes or cancel requests
+  // which consumer has not seen yet
+  bool HasPending() const {
+    return incoming_.load() != nullptr || cancel_requests_.load() != nullptr;
+  }
+
+  // Consumer
+  wheels::IntrusiveList<TimerBase> TakeAll() {
+    UpdateQueueState();
+
+    wheels::IntrusiveList<TimerBase> timers = std::move(ready_);
+
+    for (auto& level : wheel_) {
+      for (auto& slot : level) {
+        while (TimerBase* timer = slot.PopFront()) {
+          Retire(timer);
+          timers.PushBack(timer);
+        }
+      }
+    }
+
+    occupied_.fill(0);
+    size_ = 0;
+
+    return timers;
+  }
+
+  // Consumer
+  void UpdateQueueState() {
+    DrainIncoming();
+    DrainCancelRequests();
+  }
+
+  // Consumer, number of timers in the wheel
+  size_t Size() const {
+    return size_;
+  }
+
+ private:
+  //////////////////////////////////////////////////////////////////////
+
+  // Ticks are rounded up so that timers never fire early
+  uint64_t ToTick(TimePoint deadline) const {
+    if (deadline <= start_) {
+      return 0;
+    }
+
+    return std::chrono::ceil<Millis>(deadline - start_).count();
+  }
+
+  void DrainIncoming() {
+    TimerBase* current = incoming_.exchange(nullptr, std::memory_order::acquire);
+
+    // restore push order
+    TimerBase* reversed = nullptr;
+    while (current != nullptr) {
+      TimerBase* next = static_cast<TimerBase*>(current->prev_);
+      current->prev_ = reversed;
+      reversed = current;
+      current = next;
+    }
+
+    while (reversed != nullptr) {
+      TimerBase* next = static_cast<TimerBase*>(reversed->prev_);
+      reversed->prev_ = nullptr;
+
+      if (See(reversed, Incoming)) {
+        // cancel request was already processed
+        MakeReady(reversed);
+      } else if ((reversed->state.load(std::memory_order::acquire) &
+                  TimerBase::Cancelled) == 0) {
+        Insert(reversed, ToTick(reversed->deadline));
+      }
+      // else: cancel request is on its way, timer is parked until then
+
+      reversed = next;
+    }
+  }
+
+  void DrainCancelRequests() {
+    TimerBase* current =
+        cancel_requests_.exchange(nullptr, std::memory_order::acquire);
+
+    while (current != nullptr) {
+      TimerBase* next = current->next_cancelled;
+      current->next_cancelled = nullptr;
+
+      if (See(current, CancelRequests)) {
+        // O(1) removal
+        if (current->IsLinked()) {
+          current->Unlink();
+          size_--;
+        }
+
+        MakeReady(current);
+      }
+      // else: timer is still in incoming stack
+
+      current = next;
+    }
+  }
+
+  // true if timer was seen from both sides
+  static bool See(TimerBase* timer, Sightings from) {
+    timer->sightings |= from;
+    return timer->sightings == (Incoming | CancelRequests);
+  }
+
+  static void Retire(TimerBase* timer) {
+    timer->sightings = 0;
+    timer->next_cancelled = nullptr;
+  }
+
+  void MakeReady(TimerBase* timer) {
+    Retire(timer);
+    ready_.PushBack(timer);
+  }
+
+  //////////////////////////////////////////////////////////////////////
+
+  void Insert(TimerBase* timer, uint64_t tick) {
+    if (tick < current_) {
+      Fire(timer);
+      return;
+    }
+
+    uint64_t delta = tick - current_;
+
+    if (delta >= kMaxDelta) {
+      // too far, cascade will put it back
+      delta = kMaxDelta - 1;
+      tick = current_ + delta;
+    }
+
+    size_t level = 0;
+    while (delta >= ((uint64_t)1 << (kSlotBits * (level + 1)))) {
+      ++level;
+    }
+
+    size_t index = (tick >> (kSlotBits * level)) & kSlotMask;
+
+    wheel_[level][index].PushBack(timer);
+    occupied_[level] |= (uint64_t)1 << index;
+    size_++;
+  }
+
+  // Timer is not in the wheel
+  void Fire(TimerBase* timer) {
+    uint32_t expected = 0;
+
+    if (timer->state.compare_exchange_strong(expected, TimerBase::Done,
+                                             std::memory_order::acq_rel)) {
+      MakeReady(timer);
+    }
+    // else: cancelled, cancel request will complete it
+  }
+
+  // Process every tick up to (and including) `now`
+  void Advance(uint64_t now) {
+    while (current_ <= now) {
+      if (size_ == 0) {
+        // nothing to cascade, jump straight to now
+        current_ = now + 1;
+        break;
+      }
+
+      size_t index = current_ & kSlotMask;
+
+      if ((occupied_[0] >> index) == 0 && (current_ | kSlotMask) <= now) {
+        // level 0 is empty until the end of the rotation
+        current_ = (current_ | kSlotMask) + 1;
+        Cascade();
+        continue;
+      }
+
+      FireSlot(index);
+
+      current_++;
+
+      if ((current_ & kSlotMask) == 0) {
+        Cascade();
+      }
+    }
+  }
+
+  void FireSlot(size_t index) {
+    Slot& slot = wheel_[0][index];
+
+    while (TimerBase* timer = slot.PopFront()) {
+      size_--;
+      Fire(timer);
+    }
+
+    occupied_[0] &= ~((uint64_t)1 << index);
+  }
+
+  // current_ has just crossed the boundary of level 1 slot
+  void Cascade() {
+    for (size_t level = 1; level < kLevels; ++level) {
+      size_t index = (current_ >> (kSlotBits * level)) & kSlotMask;
+
+      Slot& slot = wheel_[level][index];
+
+      if ((occupied_[level] >> index) & 1) {
+        occupied_[level] &= ~((uint64_t)1 << index);
+
+        Slot timers = std::move(slot);
+
+        while (TimerBase* timer = timers.PopFront()) {
+          size_--;
+          Insert(timer, ToTick(timer->deadline));
+        }
+      }
+
+      // upper levels only move when this one wraps
+      if (index != 0) {
+        break;
+      }
+    }
+  }
+
+  // Lower bound for the next deadline
+  std::optional<Millis> UntilNext(TimePoint now) {
+    if (size_ == 0) {
+      return std::nullopt;
+    }
+
+    uint64_t next = UINT64_MAX;
+
+    for (size_t level = 0; level < kLevels; ++level) {
+      const size_t shift = kSlotBits * level;
+      const size_t from = (current_ >> shift) & kSlotMask;
+
+      // slots are cleared lazily
+      while (occupied_[level] != 0) {
+        uint64_t rotated = std::rotr(occupied_[level], from);
+
+        // at upper levels current slot is a full rotation ahead
+        if (level != 0 && (rotated & 1) != 0 && rotated != 1) {
+          rotated &= ~(uint64_t)1;
+        }
+
+        size_t distance = std::countr_zero(rotated);
+        if (level != 0 && distance == 0) {
+          distance = kSlots;
+        }
+
+        size_t index = (from + distance) & kSlotMask;
+
+        if (wheel_[level][index].IsEmpty()) {
+          occupied_[level] &= ~((uint64_t)1 << index);
+          continue;
+        }
+
+        uint64_t tick = level == 0 ? current_ + distance
+                                   : (((current_ >> shift) + distance) << shift);
+        next = std::min(next, tick);
+        break;
+      }
+    }
+
+    if (next == UINT64_MAX) {
+      return std::nullopt;
+    }
+
+    auto when = start_ + Millis(next);
+    return when <= now ? 0ms : std::chrono::ceil<Millis>(when - now);
+  }
+
+ private:
+  twist::ed::stdlike::atomic<TimerBase*> incoming_{nullptr};
+  twist::ed::stdlike::atomic<TimerBase*> cancel_requests_{nullptr};
+
+  const TimePoint start_;
+
+  // Next tick to process
+  uint64_t current_{0};
+
+  std::array<std::array<Slot, kSlots>, kLevels> wheel_{};
+  std::array<uint64_t, kLevels> occupied_{};
+  size_t size_{0};
+
+  wheels::IntrusiveList<TimerBase> ready_{};
+};
+
+}  // namespace weave::timers::detail
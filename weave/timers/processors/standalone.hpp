@@ -3,6 +3,7 @@
 #include <weave/timers/processor.hpp>
 
 #include <weave/timers/processors/detail/thread_pool_queue.hpp>
+#include <weave/timers/processors/detail/timing_wheel.hpp>
 
 #include <twist/ed/stdlike/thread.hpp>
 
@@ -16,9 +17,10 @@ using namespace std::chrono_literals;
 
 // Takes up one thread to process timers
 
-class StandaloneProcessor : public IProcessor {
+template <typename Queue>
+class StandaloneProcessorImpl : public IProcessor {
  public:
-  StandaloneProcessor()
+  StandaloneProcessorImpl()
       : worker_([this] {
           WorkerLoop();
         }) {
@@ -31,13 +33,13 @@ class StandaloneProcessor : public IProcessor {
     TryWakeWorker();
   }
 
-  void NotifyProcessor() override {
-    queue_.PostCancelRequest();
+  void NotifyProcessor(TimerBase* timer) override {
+    queue_.PostCancelRequest(timer);
 
     TryWakeWorker();
   }
 
-  ~StandaloneProcessor() override {
+  ~StandaloneProcessorImpl() override {
     Stop();
   }
 
@@ -116,11 +118,17 @@ class StandaloneProcessor : public IProcessor {
   twist::ed::stdlike::atomic<uint32_t> wakeups_{0};
   twist::ed::stdlike::atomic<bool> idle_{false};
 
-  weave::timers::detail::TimersQueue queue_{};
+  Queue queue_{};
 
   // NB : Worker created last to have every
   // other constructor in hb with it
   twist::ed::stdlike::thread worker_;
 };
 
+// Binary heap, cancelled timers are removed lazily
+using StandaloneProcessor = StandaloneProcessorImpl<detail::TimersQueue>;
+
+// Hierarchical timing wheel, cancelled timers are removed right away
+using StandaloneWheelProcessor = StandaloneProcessorImpl<detail::TimingWheel>;
+
 }  // namespace weave::timers
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #include <weave/timers/millis.hpp>
 
+#include <twist/ed/stdlike/atomic.hpp>
+
 namespace weave::timers {
 
 struct ITimer : public executors::ITask {
@@ -18,7 +20,34 @@ struct ITimer : public executors::ITask {
 };
 
 struct TimerBase : public ITimer, public wheels::IntrusiveListNode<TimerBase> {
+  TimerBase() = default;
+
+  // Bookkeeping is never copied
+  TimerBase(const TimerBase& that)
+      : ITimer(that),
+        wheels::IntrusiveListNode<TimerBase>(),
+        deadline(that.deadline) {
+  }
+
+  TimerBase& operator=(const TimerBase& that) {
+    deadline = that.deadline;
+    return *this;
+  }
+
   std::chrono::steady_clock::time_point deadline;
+
+  // Bookkeeping for processors with real removal on cancel
+
+  enum State : uint32_t {
+    Cancelled = 1,
+    Done = 2,
+  };
+
+  twist::ed::stdlike::atomic<uint32_t> state{0};
+
+  // Owned by processor
+  uint32_t sightings{0};
+  TimerBase* next_cancelled{nullptr};
 };
 
 }  // namespace weave::timers
\ No newline at end of file
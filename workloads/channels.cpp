@@ -7,6 +7,8 @@
 
 #include <weave/fibers/sync/select.hpp>
 
+#include <weave/threads/blocking/wait_group.hpp>
+
 #include <wheels/core/stop_watch.hpp>
 
 #include <iostream>
@@ -18,6 +20,9 @@ using Scheduler = executors::ThreadPool;
 
 constexpr size_t kThreads = 4;
 
+constexpr size_t kPairs = 8;
+constexpr size_t kRoundTrips = 100'000;
+
 //////////////////////////////////////////////////////////////////////
 
 void WorkLoadChannels() {
@@ -60,6 +65,53 @@ void WorkLoadChannels() {
 
 //////////////////////////////////////////////////////////////////////
 
+// Every round trip is two sends to a waiting receiver,
+// each one switches to the receiver instead of scheduling it
+void WorkLoadPingPong() {
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(2 * kPairs);
+
+  wheels::StopWatch sw;
+
+  for (size_t k = 0; k < kPairs; ++k) {
+    fibers::Channel<int> pings{1};
+    fibers::Channel<int> pongs{1};
+
+    fibers::Go(scheduler, [pings, pongs, &wg]() mutable {
+      for (size_t i = 0; i < kRoundTrips; ++i) {
+        pings.Send(1);
+        pongs.Receive();
+      }
+      wg.Done();
+    });
+
+    fibers::Go(scheduler, [pings, pongs, &wg]() mutable {
+      for (size_t i = 0; i < kRoundTrips; ++i) {
+        pongs.Send(pings.Receive());
+      }
+      wg.Done();
+    });
+  }
+
+  wg.Wait();
+
+  const auto elapsed = sw.Elapsed();
+
+  scheduler.Stop();
+
+  std::cout << "Ping-pong: "
+            << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                       .count() /
+                   (kPairs * kRoundTrips)
+            << "ns per round trip" << std::endl;
+  scheduler.Metrics().Print();
+}
+
+//////////////////////////////////////////////////////////////////////
+
 void WorkLoad() {
   wheels::StopWatch sw;
 
@@ -84,6 +136,7 @@ void WorkLoad() {
 int main() {
   while (true) {
     WorkLoad();
+    WorkLoadPingPong();
   }
   
   return 0;
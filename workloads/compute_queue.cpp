@@ -0,0 +1,89 @@
+#include <weave/executors/tp/compute/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace weave; // NOLINT
+
+using executors::tp::compute::QueueMode;
+using executors::tp::compute::ThreadPool;
+
+// Short CPU-bound tasks from external producers and from workers
+
+const size_t kTasksPerProducer = 1'000'000;
+
+void Burn() {
+  volatile size_t sink = 0;
+  for (size_t i = 0; i < 64; ++i) {
+    sink = sink + i;
+  }
+}
+
+void WorkLoad(const char* name, QueueMode mode, size_t threads) {
+  ThreadPool pool{threads, mode};
+  pool.Start();
+
+  const size_t producers = threads;
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(producers * kTasksPerProducer);
+
+  wheels::StopWatch sw;
+
+  // half of the producers are external threads
+  std::vector<twist::ed::stdlike::thread> external;
+
+  for (size_t i = 0; i < producers; ++i) {
+    auto produce = [&] {
+      for (size_t j = 0; j < kTasksPerProducer; ++j) {
+        executors::Submit(pool, [&] {
+          Burn();
+          wg.Done();
+        });
+      }
+    };
+
+    if (i % 2 == 0) {
+      external.emplace_back(produce);
+    } else {
+      executors::Submit(pool, produce);
+    }
+  }
+
+  wg.Wait();
+
+  const auto elapsed = sw.Elapsed();
+
+  for (auto& producer : external) {
+    producer.join();
+  }
+
+  pool.WaitIdle();
+
+  std::cout << name << ", " << threads << " threads: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                   .count()
+            << "ms, " << elapsed.count() / (producers * kTasksPerProducer)
+            << "ns per task" << std::endl;
+
+  pool.Stop();
+}
+
+int main() {
+  const size_t threads = std::thread::hardware_concurrency();
+
+  while (true) {
+    WorkLoad("Shared", QueueMode::Shared, threads);
+    WorkLoad("PerWorker", QueueMode::PerWorker, threads);
+  }
+
+  return 0;
+}
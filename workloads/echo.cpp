@@ -0,0 +1,173 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+
+#include <weave/io/async_fd.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+
+constexpr size_t kThreads = 4;
+constexpr size_t kClients = 64;
+constexpr size_t kRequests = 5000;
+constexpr size_t kMessageSize = 64;
+
+//////////////////////////////////////////////////////////////////////
+
+// Loopback echo server: one fiber per connection
+void Serve(io::AsyncFd& listener) {
+  for (size_t i = 0; i < kClients; ++i) {
+    auto client = listener.Accept();
+
+    if (!client) {
+      std::cout << "Accept: " << client.error().message() << std::endl;
+      return;
+    }
+
+    fibers::Go([conn = std::move(*client)]() mutable {
+      char buffer[kMessageSize];
+
+      while (true) {
+        auto bytes = conn.Read(buffer);
+
+        if (!bytes || *bytes == 0 || !conn.WriteAll({buffer, *bytes})) {
+          return;
+        }
+      }
+    });
+  }
+}
+
+// Request/response round trips, latencies in microseconds
+void Client(io::Reactor& reactor, sockaddr_in address,
+            std::vector<uint64_t>& latencies) {
+  io::AsyncFd socket(reactor, ::socket(AF_INET, SOCK_STREAM, 0));
+
+  auto connected =
+      socket.Connect(reinterpret_cast<sockaddr*>(&address), sizeof(address));
+
+  if (!connected) {
+    std::cout << "Connect: " << connected.error().message() << std::endl;
+    return;
+  }
+
+  char request[kMessageSize];
+  std::fill(request, request + kMessageSize, 'x');
+
+  char response[kMessageSize];
+
+  for (size_t i = 0; i < kRequests; ++i) {
+    wheels::StopWatch sw;
+
+    if (!socket.WriteAll(request)) {
+      return;
+    }
+
+    for (size_t received = 0; received < kMessageSize;) {
+      auto bytes = socket.Read({response + received, kMessageSize - received});
+
+      if (!bytes || *bytes == 0) {
+        return;
+      }
+
+      received += *bytes;
+    }
+
+    latencies.push_back(
+        std::chrono::duration_cast<std::chrono::microseconds>(sw.Elapsed())
+            .count());
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void WorkLoad() {
+  io::Reactor reactor;
+
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  int listen_fd = ::socket(AF_INET, SOCK_STREAM, 0);
+
+  int reuse = 1;
+  ::setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+  sockaddr_in address{};
+  address.sin_family = AF_INET;
+  address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  address.sin_port = 0;
+
+  socklen_t address_size = sizeof(address);
+
+  ::bind(listen_fd, reinterpret_cast<sockaddr*>(&address), address_size);
+  ::listen(listen_fd, kClients);
+  ::getsockname(listen_fd, reinterpret_cast<sockaddr*>(&address),
+                &address_size);
+
+  io::AsyncFd listener(reactor, listen_fd);
+
+  fibers::Go(scheduler, [&] {
+    Serve(listener);
+  });
+
+  std::vector<std::vector<uint64_t>> latencies(kClients);
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(kClients);
+
+  wheels::StopWatch sw;
+
+  for (size_t i = 0; i < kClients; ++i) {
+    fibers::Go(scheduler, [&, i] {
+      Client(reactor, address, latencies[i]);
+      wg.Done();
+    });
+  }
+
+  wg.Wait();
+
+  const auto elapsed = sw.Elapsed();
+
+  std::vector<uint64_t> all;
+  for (auto& client : latencies) {
+    all.insert(all.end(), client.begin(), client.end());
+  }
+
+  std::sort(all.begin(), all.end());
+
+  const auto millis =
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+
+  std::cout << "Requests: " << all.size() << " in " << millis << "ms, "
+            << all.size() * 1000 / std::max<uint64_t>(millis, 1)
+            << " req/s, p50 " << all[all.size() / 2] << "us, p99 "
+            << all[all.size() * 99 / 100] << "us" << std::endl;
+
+  listener.Close();
+
+  scheduler.WaitIdle();
+  scheduler.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad();
+  }
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/executors/submit.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <iostream>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+
+constexpr size_t kThreads = 4;
+
+// Non-worker threads hammering global queue
+constexpr size_t kProducers = 8;
+
+//////////////////////////////////////////////////////////////////////
+
+void WorkLoadExternalSubmits(Scheduler& scheduler){
+  constexpr size_t kTasksPerProducer = 100'000;
+
+  std::vector<twist::ed::stdlike::thread> producers;
+
+  for(size_t i = 0; i < kProducers; i++){
+    producers.emplace_back([&]{
+      for(size_t j = 0; j < kTasksPerProducer; j++){
+        executors::Submit(scheduler, [j]{
+          if(j % 64 == 0){
+            // Occasionally produce local work too
+            executors::Submit(*Scheduler::Current(), []{});
+          }
+        });
+      }
+    });
+  }
+
+  for(auto& producer : producers){
+    producer.join();
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void WorkLoad() {
+  wheels::StopWatch sw;
+
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  WorkLoadExternalSubmits(scheduler);
+
+  scheduler.WaitIdle();
+  scheduler.Stop();
+
+  const auto elapsed = sw.Elapsed();
+
+  std::cout << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms " << std::endl;
+  scheduler.Metrics().Print();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad();
+  }
+  
+  return 0;
+}
@@ -0,0 +1,221 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+
+#include <weave/parallel/for.hpp>
+#include <weave/parallel/reduce.hpp>
+#include <weave/parallel/scan.hpp>
+#include <weave/parallel/sort.hpp>
+#include <weave/parallel/transform.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace weave; // NOLINT
+
+using executors::ThreadPool;
+
+// Parallel algorithms vs serial std:: ones on large vectors
+
+const size_t kSize = 1 << 24;
+
+//////////////////////////////////////////////////////////////////////
+
+template <typename F>
+std::chrono::nanoseconds Measure(F routine) {
+  wheels::StopWatch sw;
+  routine();
+  return sw.Elapsed();
+}
+
+// Best of a few runs
+template <typename F>
+std::chrono::nanoseconds Best(F routine, size_t runs = 5) {
+  auto best = std::chrono::nanoseconds::max();
+  for (size_t i = 0; i < runs; ++i) {
+    best = std::min(best, Measure(routine));
+  }
+  return best;
+}
+
+void Report(const char* name, std::chrono::nanoseconds serial,
+            std::chrono::nanoseconds parallel) {
+  using std::chrono::microseconds;
+
+  std::cout << name << ": std " << duration_cast<microseconds>(serial).count()
+            << "us, parallel "
+            << duration_cast<microseconds>(parallel).count() << "us, x"
+            << static_cast<double>(serial.count()) / parallel.count()
+            << std::endl;
+}
+
+std::vector<int> RandomValues() {
+  std::mt19937 twister{42};
+  std::uniform_int_distribution<int> values(0, 1'000'000);
+
+  std::vector<int> result(kSize);
+  for (auto& value : result) {
+    value = values(twister);
+  }
+  return result;
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void ForCheap(ThreadPool& pool) {
+  std::vector<int> values(kSize, 1);
+
+  auto serial = Best([&] {
+    std::for_each(values.begin(), values.end(), [](int& value) {
+      value = value * 3 + 1;
+    });
+  });
+
+  auto parallel = Best([&] {
+    parallel::For(pool, values, [](int& value) {
+      value = value * 3 + 1;
+    });
+  });
+
+  Report("For (cheap)", serial, parallel);
+}
+
+void ForExpensive(ThreadPool& pool) {
+  std::vector<double> values(kSize / 16, 1.5);
+
+  auto body = [](double& value) {
+    for (size_t i = 0; i < 64; ++i) {
+      value = std::sqrt(value + 1.0);
+    }
+  };
+
+  auto serial = Best([&] {
+    std::for_each(values.begin(), values.end(), body);
+  });
+
+  auto parallel = Best([&] {
+    parallel::For(pool, values, body);
+  });
+
+  Report("For (expensive)", serial, parallel);
+}
+
+void Reduce(ThreadPool& pool) {
+  auto values = RandomValues();
+
+  int64_t expected = 0;
+  auto serial = Best([&] {
+    expected = std::reduce(values.begin(), values.end(), int64_t{0});
+  });
+
+  int64_t result = 0;
+  auto parallel = Best([&] {
+    result = parallel::Reduce(pool, values, int64_t{0});
+  });
+
+  WHEELS_VERIFY(result == expected, "Wrong Reduce result");
+
+  Report("Reduce", serial, parallel);
+}
+
+void Transform(ThreadPool& pool) {
+  auto values = RandomValues();
+  std::vector<double> out(kSize);
+
+  auto op = [](int value) {
+    return std::log1p(static_cast<double>(value));
+  };
+
+  auto serial = Best([&] {
+    std::transform(values.begin(), values.end(), out.begin(), op);
+  });
+
+  auto parallel = Best([&] {
+    parallel::Transform(pool, values, out.begin(), op);
+  });
+
+  Report("Transform", serial, parallel);
+}
+
+void Scan(ThreadPool& pool) {
+  auto values = RandomValues();
+  std::vector<int64_t> expected(kSize);
+  std::vector<int64_t> out(kSize);
+
+  auto serial = Best([&] {
+    std::inclusive_scan(values.begin(), values.end(), expected.begin(),
+                        std::plus<>{}, int64_t{0});
+  });
+
+  auto parallel = Best([&] {
+    parallel::Scan(pool, values, out.begin(), int64_t{0});
+  });
+
+  WHEELS_VERIFY(out == expected, "Wrong Scan result");
+
+  Report("Scan", serial, parallel);
+}
+
+void Sort(ThreadPool& pool) {
+  const auto values = RandomValues();
+
+  auto serial = Best(
+      [&] {
+        auto copy = values;
+        std::sort(copy.begin(), copy.end());
+      },
+      3);
+
+  auto parallel = Best(
+      [&] {
+        auto copy = values;
+        parallel::Sort(pool, copy);
+      },
+      3);
+
+  Report("Sort", serial, parallel);
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  const size_t threads = std::thread::hardware_concurrency();
+
+  ThreadPool pool{threads};
+  pool.Start();
+
+  std::cout << "Threads: " << threads << ", elements: " << kSize
+            << std::endl;
+
+  // Caller is a fiber of the pool: it runs a share of every call
+  threads::blocking::WaitGroup wg;
+  wg.Add(1);
+
+  fibers::Go(pool, [&] {
+    ForCheap(pool);
+    ForExpensive(pool);
+    Reduce(pool);
+    Transform(pool);
+    Scan(pool);
+    Sort(pool);
+
+    wg.Done();
+  });
+
+  wg.Wait();
+
+  pool.Stop();
+
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/executors/submit.hpp>
+
+#include <weave/executors/tp/fast/local_queue.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <iostream>
+#include <type_traits>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+
+constexpr size_t kThreads = 4;
+
+// Every spawner submits kFanOut children at once,
+// which is far more than the bounded local queue holds
+constexpr size_t kSpawners = 64;
+constexpr size_t kFanOut = 10'000;
+
+//////////////////////////////////////////////////////////////////////
+
+void Spawn(Scheduler& scheduler) {
+  for (size_t i = 0; i < kSpawners; ++i) {
+    executors::Submit(scheduler, [&scheduler] {
+      for (size_t j = 0; j < kFanOut; ++j) {
+        executors::Submit(scheduler, [] {});
+      }
+    });
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void WorkLoad() {
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  wheels::StopWatch sw;
+
+  executors::Submit(scheduler, [&scheduler] {
+    Spawn(scheduler);
+  });
+
+  scheduler.WaitIdle();
+
+  const auto elapsed = sw.Elapsed();
+
+  scheduler.Stop();
+
+  constexpr bool kGrowable =
+      std::is_same_v<executors::tp::fast::DefaultLocalQueue,
+                     executors::tp::fast::GrowableLocalQueue>;
+
+  // rebuild with WEAVE_GROWABLE_LOCAL_QUEUE to compare
+  std::cout << (kGrowable ? "Growable" : "Bounded") << " local queue: "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                   .count()
+            << "ms" << std::endl;
+  scheduler.Metrics().Print();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad();
+  }
+
+  return 0;
+}
@@ -0,0 +1,101 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/coro/stack_allocator.hpp>
+
+#include <weave/fibers/sched/go.hpp>
+#include <weave/fibers/sync/event.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <fstream>
+#include <iostream>
+
+#include <unistd.h>
+
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+
+constexpr size_t kThreads = 4;
+
+//////////////////////////////////////////////////////////////////////
+
+struct Memory {
+  size_t virtual_bytes = 0;
+  size_t resident_bytes = 0;
+};
+
+Memory Measure() {
+  size_t total_pages = 0;
+  size_t resident_pages = 0;
+
+  std::ifstream("/proc/self/statm") >> total_pages >> resident_pages;
+
+  const size_t page = sysconf(_SC_PAGESIZE);
+
+  return {total_pages * page, resident_pages * page};
+}
+
+//////////////////////////////////////////////////////////////////////
+
+// Parks `count` fibers at once and reports RSS while all of them are alive
+void WorkLoad(size_t count, fibers::StackSize stack_size) {
+  wheels::StopWatch sw;
+
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  const Memory before = Measure();
+
+  fibers::Event release;
+  threads::blocking::WaitGroup started;
+  started.Add(count);
+
+  for(size_t i = 0; i < count; i++){
+    fibers::Go(scheduler, [&]{
+      started.Done();
+      release.Wait();
+    }, stack_size);
+  }
+
+  started.Wait();
+
+  const Memory peak = Measure();
+
+  release.Fire();
+
+  scheduler.WaitIdle();
+  scheduler.Stop();
+
+  const auto elapsed = sw.Elapsed();
+
+  const size_t rss = peak.resident_bytes - before.resident_bytes;
+  const size_t vsz = peak.virtual_bytes - before.virtual_bytes;
+
+  std::cout << count << " fibers, " << stack_size.bytes / 1024 << "KiB stacks: "
+            << rss / 1024 / 1024 << "MiB RSS (" << rss / count << "B per fiber), "
+            << vsz / 1024 / 1024 << "MiB address space, "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms " << std::endl;
+
+  coro::StackAllocator::Instance().Metrics().Print();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  // Guard pages split every stack into two mappings,
+  // a million of them runs into vm.max_map_count
+  coro::StackAllocator::Options options;
+  options.guard_pages = false;
+  coro::StackAllocator::Instance().Configure(options);
+
+  for (size_t count : {10'000, 100'000, 1'000'000}) {
+    WorkLoad(count, fibers::StackSize::Tiny());
+    WorkLoad(count, fibers::StackSize::Small());
+    WorkLoad(count, fibers::StackSize::Default());
+  }
+
+  return 0;
+}
@@ -0,0 +1,78 @@
+#include <weave/executors/thread_pool.hpp>
+
+#include <weave/executors/submit.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <iostream>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+using executors::tp::fast::StealPolicy;
+
+constexpr size_t kThreads = 8;
+
+//////////////////////////////////////////////////////////////////////
+
+void Burn() {
+  volatile size_t sink = 0;
+  for (size_t i = 0; i < 256; ++i) {
+    sink = sink + i;
+  }
+}
+
+// Few workers produce, everybody else has to find them
+void WorkLoadImbalanced() {
+  constexpr size_t kProducers = 2;
+  constexpr size_t kRounds = 1000;
+  constexpr size_t kTasksPerRound = 200;
+
+  for (size_t i = 0; i < kProducers; i++) {
+    executors::Submit(*Scheduler::Current(), [] {
+      for (size_t round = 0; round < kRounds; round++) {
+        for (size_t j = 0; j < kTasksPerRound; j++) {
+          executors::Submit(*Scheduler::Current(), [] {
+            Burn();
+          });
+        }
+        Burn();
+      }
+    });
+  }
+}
+
+//////////////////////////////////////////////////////////////////////
+
+void WorkLoad(const char* name, StealPolicy policy) {
+  wheels::StopWatch sw;
+
+  Scheduler scheduler{kThreads};
+  scheduler.SetStealPolicy(policy);
+  scheduler.Start();
+
+  executors::Submit(scheduler, [] {
+    WorkLoadImbalanced();
+  });
+
+  scheduler.WaitIdle();
+  scheduler.Stop();
+
+  const auto elapsed = sw.Elapsed();
+
+  std::cout << name << ": " << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count() << "ms " << std::endl;
+  // compare "Steal probes", "Empty steal probes" and "Stolen from ..."
+  scheduler.Metrics().Print();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad("Random", StealPolicy::Random);
+    WorkLoad("Load aware", StealPolicy::LoadAware);
+  }
+
+  return 0;
+}
@@ -0,0 +1,191 @@
+#include <weave/executors/tp/compute/thread_pool.hpp>
+#include <weave/executors/strand.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/threads/blocking/wait_group.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+
+#include <iostream>
+#include <limits>
+#include <list>
+#include <memory>
+
+using namespace weave; // NOLINT
+
+using executors::tp::compute::ThreadPool;
+
+//////////////////////////////////////////////////////////////////////
+
+// Previous Strand: Treiber stack behind a shared_ptr, reversed on every Run
+class StackStrand : public executors::IExecutor,
+                    public executors::Task {
+  using Node = wheels::IntrusiveListNode<executors::Task>;
+  using AtomicPtr = twist::ed::stdlike::atomic<Node*>;
+
+ public:
+  explicit StackStrand(executors::IExecutor& underlying)
+      : underlying_(underlying),
+        stack_(std::make_shared<AtomicPtr>(nullptr)) {
+  }
+
+  void Submit(executors::Task* task, executors::SchedulerHint) override {
+    Node* former_top = stack_->load(std::memory_order::relaxed);
+
+    do {
+      task->next_ = former_top;
+    } while (!stack_->compare_exchange_weak(former_top, task,
+                                            std::memory_order::seq_cst,
+                                            std::memory_order::relaxed));
+
+    if (former_top == kIdle) {
+      underlying_.Submit(this);
+    }
+  }
+
+ private:
+  void Run() noexcept override {
+    auto preserved_stack = stack_;
+
+    Node* head = preserved_stack->exchange(Underway(),
+                                           std::memory_order::acquire);
+
+    while (head->next_ != Underway() && head->next_ != kIdle) {
+      head->next_->prev_ = head;
+      head = head->next_;
+    }
+
+    while (head != nullptr) {
+      Node* task = head;
+      head = head->prev_;
+      task->prev_ = task->next_ = nullptr;
+      task->AsItem()->Run();
+    }
+
+    Node* expected = Underway();
+    if (!preserved_stack->compare_exchange_strong(
+            expected, kIdle, std::memory_order::release,
+            std::memory_order::relaxed)) {
+      underlying_.Submit(this);
+    }
+  }
+
+  static Node* Underway() {
+    return reinterpret_cast<Node*>(std::numeric_limits<uintptr_t>::max());
+  }
+
+ private:
+  static constexpr Node* kIdle = nullptr;
+
+  executors::IExecutor& underlying_;
+  std::shared_ptr<AtomicPtr> stack_;
+};
+
+//////////////////////////////////////////////////////////////////////
+
+constexpr size_t kWorkers = 4;
+
+// Same shape as tests/executors/strand: many clients, many strands
+template <typename StrandType>
+void ConcurrentStrands(const char* name, size_t strands_count,
+                       size_t pushes) {
+  ThreadPool workers{kWorkers};
+  workers.Start();
+
+  ThreadPool clients{kWorkers};
+  clients.Start();
+
+  std::list<StrandType> strands;
+  for (size_t i = 0; i < strands_count; ++i) {
+    strands.emplace_back(workers);
+  }
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(strands_count * pushes);
+
+  wheels::StopWatch sw;
+
+  for (auto& strand : strands) {
+    executors::Submit(clients, [&strand, &wg, pushes] {
+      for (size_t j = 0; j < pushes; ++j) {
+        executors::Submit(strand, [&wg] {
+          wg.Done();
+        });
+      }
+    });
+  }
+
+  wg.Wait();
+
+  const auto elapsed = sw.Elapsed();
+
+  std::cout << name << ": " << strands_count << " strands x " << pushes
+            << " tasks in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                   .count()
+            << "ms, "
+            << elapsed.count() / (strands_count * pushes) << "ns per task"
+            << std::endl;
+
+  clients.Stop();
+  workers.Stop();
+}
+
+// One hot strand, producers on every client thread
+template <typename StrandType>
+void Counter(const char* name, size_t increments) {
+  ThreadPool workers{kWorkers};
+  workers.Start();
+
+  ThreadPool clients{kWorkers};
+  clients.Start();
+
+  StrandType strand{workers};
+
+  size_t counter = 0;
+
+  threads::blocking::WaitGroup wg;
+  wg.Add(increments);
+
+  wheels::StopWatch sw;
+
+  for (size_t i = 0; i < kWorkers; ++i) {
+    executors::Submit(clients, [&] {
+      for (size_t j = 0; j < increments / kWorkers; ++j) {
+        executors::Submit(strand, [&] {
+          ++counter;
+          wg.Done();
+        });
+      }
+    });
+  }
+
+  wg.Wait();
+
+  const auto elapsed = sw.Elapsed();
+
+  std::cout << name << ": " << counter << " increments in "
+            << std::chrono::duration_cast<std::chrono::milliseconds>(elapsed)
+                   .count()
+            << "ms, " << elapsed.count() / increments << "ns per task"
+            << std::endl;
+
+  clients.Stop();
+  workers.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    ConcurrentStrands<StackStrand>("Stack strand", 1000, 1000);
+    ConcurrentStrands<executors::Strand>("MPSC strand", 1000, 1000);
+
+    Counter<StackStrand>("Stack strand", 4'000'000);
+    Counter<executors::Strand>("MPSC strand", 4'000'000);
+  }
+
+  return 0;
+}
@@ -0,0 +1,137 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/strand.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <list>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+using Clock = std::chrono::steady_clock;
+
+// Every worker is kept busy by its own hot strand
+constexpr size_t kThreads = 2;
+constexpr size_t kHotStrands = kThreads;
+
+constexpr size_t kMaxInFlight = 1024;
+constexpr auto kTaskCost = 2us;
+
+constexpr size_t kProbes = 2000;
+constexpr auto kProbeInterval = 200us;
+
+//////////////////////////////////////////////////////////////////////
+
+void Burn(std::chrono::nanoseconds cost) {
+  const auto until = Clock::now() + cost;
+  while (Clock::now() < until) {
+  }
+}
+
+// Latency of independent tasks submitted to the same pool
+void WorkLoad(const char* name, executors::Strand::Budget budget) {
+  Scheduler scheduler{kThreads};
+  scheduler.Start();
+
+  std::list<executors::Strand> strands;
+  for (size_t i = 0; i < kHotStrands; ++i) {
+    strands.emplace_back(scheduler, budget);
+  }
+
+  twist::ed::stdlike::atomic<bool> stop{false};
+  twist::ed::stdlike::atomic<size_t> hot_done{0};
+
+  // Keep strands saturated
+  std::vector<twist::ed::stdlike::thread> producers;
+  for (auto& strand : strands) {
+    producers.emplace_back([&] {
+      twist::ed::stdlike::atomic<size_t> in_flight{0};
+
+      while (!stop.load()) {
+        if (in_flight.load() >= kMaxInFlight) {
+          twist::ed::stdlike::this_thread::yield();
+          continue;
+        }
+
+        in_flight.fetch_add(1);
+        executors::Submit(strand, [&] {
+          Burn(kTaskCost);
+          hot_done.fetch_add(1, std::memory_order::relaxed);
+          in_flight.fetch_sub(1);
+        });
+      }
+
+      while (in_flight.load() > 0) {
+        twist::ed::stdlike::this_thread::yield();
+      }
+    });
+  }
+
+  std::vector<uint64_t> latencies(kProbes);
+  twist::ed::stdlike::atomic<size_t> probes_done{0};
+
+  wheels::StopWatch sw;
+
+  for (size_t i = 0; i < kProbes; ++i) {
+    const auto submitted = Clock::now();
+
+    executors::Submit(scheduler, [&, i, submitted] {
+      latencies[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                         Clock::now() - submitted)
+                         .count();
+      probes_done.fetch_add(1);
+    });
+
+    twist::ed::stdlike::this_thread::sleep_for(kProbeInterval);
+  }
+
+  while (probes_done.load() < kProbes) {
+    twist::ed::stdlike::this_thread::sleep_for(1ms);
+  }
+
+  const auto elapsed = sw.Elapsed();
+
+  stop.store(true);
+  for (auto& producer : producers) {
+    producer.join();
+  }
+
+  scheduler.WaitIdle();
+
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto millis =
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+
+  std::cout << name << ": hot tasks " << hot_done.load() << " in " << millis
+            << "ms, probe p50 " << latencies[kProbes / 2] << "us, p99 "
+            << latencies[kProbes * 99 / 100] << "us, max "
+            << latencies.back() << "us" << std::endl;
+
+  for (auto& strand : strands) {
+    strand.Metrics().Print();
+  }
+
+  scheduler.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad("Unlimited", {});
+    WorkLoad("64 tasks", {.max_tasks = 64});
+    WorkLoad("100us", {.max_time = 100us});
+  }
+
+  return 0;
+}
@@ -0,0 +1,113 @@
+#include <weave/executors/thread_pool.hpp>
+#include <weave/executors/submit.hpp>
+
+#include <weave/satellite/satellite.hpp>
+
+#include <wheels/core/stop_watch.hpp>
+
+#include <twist/ed/stdlike/atomic.hpp>
+#include <twist/ed/stdlike/thread.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace std::chrono_literals;
+using namespace weave; // NOLINT
+
+using Scheduler = executors::ThreadPool;
+using Clock = std::chrono::steady_clock;
+
+// Every worker is taken by its own CPU-hungry task
+constexpr size_t kThreads = 2;
+constexpr size_t kHogs = kThreads;
+
+constexpr auto kChunk = 10us;
+
+constexpr size_t kProbes = 2000;
+constexpr auto kProbeInterval = 200us;
+
+// Without slicing probes wait for hogs to finish
+constexpr auto kHogTime = kProbes * kProbeInterval;
+
+//////////////////////////////////////////////////////////////////////
+
+void Burn(std::chrono::nanoseconds cost) {
+  const auto until = Clock::now() + cost;
+  while (Clock::now() < until) {
+  }
+}
+
+// Latency of short tasks submitted next to tasks which never Yield
+void WorkLoad(const char* name, fibers::TimeSlice slice) {
+  Scheduler scheduler{kThreads};
+  scheduler.SetTimeSlice(slice);
+  scheduler.Start();
+
+  twist::ed::stdlike::atomic<size_t> chunks{0};
+
+  for (size_t i = 0; i < kHogs; ++i) {
+    executors::Submit(scheduler, [&] {
+      wheels::StopWatch hog_sw;
+
+      while (hog_sw.Elapsed() < kHogTime) {
+        Burn(kChunk);
+        chunks.fetch_add(1, std::memory_order::relaxed);
+
+        // cancellation point, the only place a slice can end
+        satellite::PollToken();
+      }
+    });
+  }
+
+  std::vector<uint64_t> latencies(kProbes);
+  twist::ed::stdlike::atomic<size_t> probes_done{0};
+
+  wheels::StopWatch sw;
+
+  for (size_t i = 0; i < kProbes; ++i) {
+    const auto submitted = Clock::now();
+
+    executors::Submit(scheduler, [&, i, submitted] {
+      latencies[i] = std::chrono::duration_cast<std::chrono::microseconds>(
+                         Clock::now() - submitted)
+                         .count();
+      probes_done.fetch_add(1);
+    });
+
+    twist::ed::stdlike::this_thread::sleep_for(kProbeInterval);
+  }
+
+  while (probes_done.load() < kProbes) {
+    twist::ed::stdlike::this_thread::sleep_for(1ms);
+  }
+
+  const auto elapsed = sw.Elapsed();
+
+  scheduler.WaitIdle();
+
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto millis =
+      std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count();
+
+  std::cout << name << ": hog chunks " << chunks.load() << " in " << millis
+            << "ms, probe p50 " << latencies[kProbes / 2] << "us, p99 "
+            << latencies[kProbes * 99 / 100] << "us, max "
+            << latencies.back() << "us" << std::endl;
+
+  scheduler.Stop();
+}
+
+//////////////////////////////////////////////////////////////////////
+
+int main() {
+  while (true) {
+    WorkLoad("No slicing", {});
+    WorkLoad("1ms", {.budget = 1ms});
+    WorkLoad("1ms + watchdog", {.budget = 1ms, .watchdog = true});
+  }
+
+  return 0;
+}